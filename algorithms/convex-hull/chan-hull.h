@@ -0,0 +1,318 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef CHAN_HULL_H
+#define CHAN_HULL_H
+
+#include "monotone-chain.h"
+
+/* | 매크로 정의... | */
+
+/* 
+    처음에 가정할 볼록 껍질의 점의 개수이자, 점들을 묶을 크기. 
+
+    묶음의 크기가 너무 작으면 작은 볼록 껍질을 만들고 접선을 긋는 비용이
+    볼록 껍질의 점의 개수를 잘못 가정하여 낭비하는 시간보다 더 커진다.
+*/
+#define CHAN_HULL_INITIAL_GROUP_SIZE  256
+
+/* | 라이브러리 함수... | */
+
+/* 
+    찬 알고리즘을 이용하여, 볼록 껍질을 생성한다. 
+
+    `result`는 `n`개의 점을 저장할 수 있어야 하며, `points`는 변경하지 않는다.
+*/
+int chan_hull(const Vector2 *points, int n, Vector2 *result);
+
+#endif // `CHAN_HULL_H`
+
+#ifdef CHAN_HULL_IMPLEMENTATION
+
+#ifndef MONOTONE_CHAIN_IMPLEMENTATION
+#define MONOTONE_CHAIN_IMPLEMENTATION
+#endif
+
+#include "monotone-chain.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* | 라이브러리 함수... | */
+
+/* 세 점이 반시계 방향으로 정렬되어 있는지 확인한다. */
+static int chan_hull_ccw(Vector2 v1, Vector2 v2, Vector2 v3) {
+    const double cross = ((double) v2.x - v1.x) * ((double) v3.y - v1.y) 
+        - ((double) v2.y - v1.y) * ((double) v3.x - v1.x);
+
+    // -1이면 시계 방향, 0이면 일직선 상에 위치, 1이면 반시계 방향.
+    return (cross > 0.0) - (cross < 0.0);
+}
+
+/* 두 점 사이의 거리의 제곱을 반환한다. */
+static double chan_hull_length_sqr(Vector2 v1, Vector2 v2) {
+    const double dx = (double) v2.x - v1.x, dy = (double) v2.y - v1.y;
+
+    return dx * dx + dy * dy;
+}
+
+/* 
+    기준점 `p`에서 바라본 두 점의 방향을 비교한다. 
+
+    `v2`가 `v1`보다 반시계 방향에 있으면 -1, 시계 방향에 있으면 1, 
+    같은 방향에 있으면 0을 반환한다. 기준점과 같은 점은 가장 반시계 
+    방향에 있는 것으로 간주한다.
+*/
+static int chan_hull_compare(Vector2 p, Vector2 v1, Vector2 v2) {
+    const int p_v1 = (v1.x == p.x && v1.y == p.y);
+    const int p_v2 = (v2.x == p.x && v2.y == p.y);
+
+    if (p_v1 || p_v2) return p_v1 - p_v2;
+
+    return -chan_hull_ccw(p, v1, v2);
+}
+
+/* 
+    `points`의 볼록 껍질을 `result`에 저장한다. 
+
+    모든 점이 일직선 위에 있다면, 양 끝 점만을 저장한다.
+*/
+static int chan_hull_mini_hull(const Vector2 *points, int n, Vector2 *scratch, Vector2 *result) {
+    const int count = monotone_chain(points, n, scratch, result);
+
+    if (count > 0) return count;
+
+    if (n < 3) {
+        memcpy(result, points, n * sizeof *points);
+
+        return n;
+    }
+
+    // `monotone_chain()` 함수가 `scratch`에 점들을 정렬해두었으므로, 양 끝 점을 바로 찾을 수 있다.
+    result[0] = scratch[0], result[1] = scratch[n - 1];
+
+    return 2;
+}
+
+/* 
+    기준점 `p`에서 볼록 다각형 `hull`에 그은 접선 중, 볼록 다각형 전체가
+    접선의 왼쪽에 오도록 하는 접점의 인덱스를 반환한다.
+*/
+static int chan_hull_tangent(Vector2 p, const Vector2 *hull, int n) {
+    int result = 0;
+
+    if (n <= 2) {
+        // 볼록 다각형이 점이나 선분이라면, 모든 점을 확인한다.
+        for (int i = 1; i < n; i++) {
+            const int direction = chan_hull_compare(p, hull[result], hull[i]);
+
+            if (direction > 0 || (direction == 0 
+                && chan_hull_length_sqr(p, hull[i]) > chan_hull_length_sqr(p, hull[result])))
+                result = i;
+        }
+
+        return result;
+    }
+
+    /*
+        기준점에서 볼록 다각형의 점들을 반시계 방향 순서로 바라보면, 점들의
+        방향은 한 접점에서 다른 접점까지 단조 증가하다가, 다시 처음 접점까지
+        단조 감소한다. 이때 기준점이 볼록 다각형의 한 점이라면, 그 점을 가장
+        반시계 방향에 있는 점으로 생각하면 된다. (`chan_hull_compare()`)
+
+        따라서 가장 시계 방향에 있는 점, 즉 구하려는 접점은 "방향이 감소하던
+        점들이 다시 증가하기 시작하는 점"이 되며, 0번 점과의 비교를 통해
+        이러한 점이 어느 쪽에 있는지 알 수 있으므로 이진 탐색으로 찾을 수 있다.
+    */
+
+#define CHAN_HULL_LESS(i, j)  (chan_hull_compare(p, hull[(i) % n], hull[(j) % n]) < 0)
+
+    const int ascending = CHAN_HULL_LESS(0, 1), descending = CHAN_HULL_LESS(1, 0);
+
+    if (ascending ? !CHAN_HULL_LESS(n - 1, 0) : (!descending && CHAN_HULL_LESS(1, 2))) {
+        // 0번 점이 바로 접점이다.
+        result = 0;
+    } else {
+        // 0번 점과 1번 점의 방향이 같다면, 두 점은 가장 반시계 방향에 있는 점이다.
+        int low = (ascending || descending) ? 1 : 2, high = n - 1;
+
+        while (low < high) {
+            const int mid = low + (high - low) / 2;
+
+            /*
+                0번 점에서 방향이 증가한다면, 접점은 0번 점보다 시계 방향에 
+                있으면서 방향이 감소하지 않는 첫 번째 점이다. 그렇지 않다면,
+                접점은 방향이 감소하지 않거나 0번 점보다 반시계 방향에 있는
+                첫 번째 점이다.
+            */
+            const int found = ascending
+                ? (CHAN_HULL_LESS(mid, 0) && !CHAN_HULL_LESS(mid + 1, mid))
+                : (!CHAN_HULL_LESS(mid + 1, mid) || !CHAN_HULL_LESS(mid, 0));
+
+            if (found) high = mid;
+            else low = mid + 1;
+        }
+
+        result = low;
+    }
+
+#undef CHAN_HULL_LESS
+
+    // 접점과 같은 방향에 있는 점이 있다면, 기준점과 거리가 더 먼 점을 선택한다.
+    for (int i = n - 1; i <= n + 1; i += 2) {
+        const int neighbor = (result + i) % n;
+
+        if (chan_hull_compare(p, hull[result], hull[neighbor]) == 0
+            && chan_hull_length_sqr(p, hull[neighbor]) > chan_hull_length_sqr(p, hull[result]))
+            return neighbor;
+    }
+
+    return result;
+}
+
+/* 
+    찬 알고리즘을 이용하여, 볼록 껍질을 생성한다. 
+
+    `result`는 `n`개의 점을 저장할 수 있어야 하며, `points`는 변경하지 않는다.
+*/
+int chan_hull(const Vector2 *points, int n, Vector2 *result) {
+    if (points == NULL || n < 3 || result == NULL) return 0;
+
+    /*
+        찬 (Chan) 알고리즘은 볼록 껍질의 점의 개수 `h`를 알고 있다고 가정하고,
+        점들을 `m (>= h)`개씩 묶어 각 묶음의 작은 볼록 껍질을 만든 다음,
+        선물 포장 알고리즘을 작은 볼록 껍질들 위에서 수행한다.
+
+        선물 포장 알고리즘의 각 단계에서는 모든 점을 확인하는 대신, 각각의
+        작은 볼록 껍질에 이진 탐색으로 접선을 그어 다음 점의 후보를 찾으므로,
+        작은 볼록 껍질을 만드는 데 `O(n log m)`, 볼록 껍질을 찾는 데 
+        `O(h * (n / m) * log m)`의 시간이 걸린다.
+
+        `h`는 미리 알 수 없으므로, `m = min(2^(2^t), n)`으로 두고 `t`를
+        늘려가며 (`m`을 제곱해가며) `m`단계 안에 볼록 껍질이 완성될 때까지 
+        반복한다. 이렇게 하면 전체 시간 복잡도는 `O(n log h)`가 된다. 
+        
+        `t = 1`부터 시작하면 `m`이 너무 작아 실패할 것이 뻔한 반복에 시간을
+        많이 쓰게 되므로, 여기서는 `m = CHAN_HULL_INITIAL_GROUP_SIZE`부터
+        시작한다. `log m`이 상수이므로 시간 복잡도는 그대로이다.
+
+        이때 작은 볼록 껍질에 포함되지 않은 점은 볼록 껍질에도 포함되지
+        않으므로, 다음 반복에서는 작은 볼록 껍질의 점들만을 다시 묶는다.
+
+        볼록 껍질의 점들은 `monotone_chain()` 함수와 마찬가지로, X 좌표가
+        가장 작은 점부터 반시계 방향으로 `result`에 저장된다.
+    */
+
+    Vector2 *hulls = malloc(3 * n * sizeof *hulls);
+
+    if (hulls == NULL) return 0;
+
+    // 각 작은 볼록 껍질의 시작 위치와 점의 개수를 저장한다.
+    int *offsets = malloc(2 * (n / CHAN_HULL_INITIAL_GROUP_SIZE + 1) * sizeof *offsets);
+
+    if (offsets == NULL) {
+        free(hulls);
+
+        return 0;
+    }
+
+    Vector2 *target = hulls, *spare = hulls + n, *scratch = hulls + 2 * n;
+
+    int *counts = offsets + (n / CHAN_HULL_INITIAL_GROUP_SIZE + 1);
+
+    int start_index = 0, count = 0;
+
+    // 먼저 X 좌표가 가장 작은 점을 찾는다. 이러한 점이 여러 개인 경우에는 가장 아래에 있는 점을 선택한다.
+    for (int i = 1; i < n; i++)
+        if ((points[start_index].x > points[i].x)
+            || (points[start_index].x == points[i].x && points[start_index].y > points[i].y))
+            start_index = i;
+
+    const Vector2 start = points[start_index];
+
+    for (int m = CHAN_HULL_INITIAL_GROUP_SIZE;; m = (m < n / m) ? m * m : n) {
+        // 모든 점을 하나로 묶는다면, 작은 볼록 껍질이 곧 볼록 껍질이 된다.
+        if (m >= n) {
+            count = monotone_chain(points, n, scratch, result);
+
+            break;
+        }
+
+        int group_count = 0, offset = 0;
+
+        for (int i = 0; i < n; i += m, group_count++) {
+            offsets[group_count] = offset;
+            counts[group_count] = chan_hull_mini_hull(
+                points + i, (n - i < m) ? n - i : m, scratch, target + offset
+            );
+
+            offset += counts[group_count];
+        }
+
+        Vector2 current = start;
+
+        for (count = 0; count < m; count++) {
+            result[count] = current;
+
+            // 각각의 작은 볼록 껍질에 접선을 그어, 가장 시계 방향에 있는 점을 찾는다.
+            Vector2 next = current;
+
+            for (int i = 0; i < group_count; i++) {
+                const Vector2 *hull = target + offsets[i];
+
+                const Vector2 candidate = hull[chan_hull_tangent(current, hull, counts[i])];
+
+                const int direction = chan_hull_compare(current, next, candidate);
+
+                if (direction > 0 || (direction == 0 
+                    && chan_hull_length_sqr(current, candidate) > chan_hull_length_sqr(current, next)))
+                    next = candidate;
+            }
+
+            // 첫 번째 점으로 다시 되돌아왔다면, 볼록 껍질 생성이 완료된 것이다.
+            if (next.x == result[0].x && next.y == result[0].y) break;
+
+            current = next;
+        }
+
+        // `m`단계 안에 볼록 껍질을 완성했다면, 반복을 종료한다.
+        if (count < m) {
+            count++;
+
+            break;
+        }
+
+        // 작은 볼록 껍질의 점들을 다음 반복의 입력으로 사용하고, 다른 메모리 공간에 작은 볼록 껍질을 만든다.
+        Vector2 *temp = target;
+
+        target = spare, spare = temp;
+
+        points = spare, n = offset;
+    }
+
+    free(offsets);
+    free(hulls);
+
+    return (count < 3) ? 0 : count;
+}
+
+#endif // `CHAN_HULL_IMPLEMENTATION`
\ No newline at end of file
@@ -0,0 +1,135 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef MONOTONE_CHAIN_H
+#define MONOTONE_CHAIN_H
+
+/* | 자료형 선언 및 정의... | */
+
+#ifndef RAYLIB_H
+
+/* 2차원 벡터를 나타내는 구조체. */
+typedef struct Vector2 {
+    float x;  // 2차원 벡터의 X 좌표.
+    float y;  // 2차원 벡터의 Y 좌표.
+} Vector2;
+
+#endif
+
+/* | 라이브러리 함수... | */
+
+/* 
+    모노톤 체인 알고리즘을 이용하여, 볼록 껍질을 생성한다. 
+
+    `scratch`와 `result`는 모두 `n`개의 점을 저장할 수 있어야 하며, 
+    `points`는 변경하지 않는다.
+*/
+int monotone_chain(const Vector2 *points, int n, Vector2 *scratch, Vector2 *result);
+
+#endif // `MONOTONE_CHAIN_H`
+
+#if defined(MONOTONE_CHAIN_IMPLEMENTATION) && !defined(MONOTONE_CHAIN_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define MONOTONE_CHAIN_IMPLEMENTED
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../sorting/sort-define.h"
+
+/* | 라이브러리 함수... | */
+
+/* 점들을 X 좌표, Y 좌표 순서로 정렬하는 함수들을 만든다. */
+SORT_DEFINE(monotone_chain_points, Vector2, (a.x < b.x) || (a.x == b.x && a.y < b.y))
+
+/* 
+    세 점이 반시계 방향으로 정렬되어 있는지 확인한다. 
+
+    외적은 `double`로 계산하여, 좌표가 클 때도 정밀도를 잃지 않도록 한다.
+*/
+static double monotone_chain_cross(Vector2 v1, Vector2 v2, Vector2 v3) {
+    return ((double) v2.x - v1.x) * ((double) v3.y - v1.y) 
+        - ((double) v2.y - v1.y) * ((double) v3.x - v1.x);
+}
+
+/* 
+    모노톤 체인 알고리즘을 이용하여, 볼록 껍질을 생성한다. 
+
+    `scratch`와 `result`는 모두 `n`개의 점을 저장할 수 있어야 하며, 
+    `points`는 변경하지 않는다.
+*/
+int monotone_chain(const Vector2 *points, int n, Vector2 *scratch, Vector2 *result) {
+    if (points == NULL || n < 3 || scratch == NULL || result == NULL) return 0;
+
+    /*
+        모노톤 체인 (Andrew) 알고리즘은 점들을 X 좌표 순서로 정렬한 다음, 
+        왼쪽에서 오른쪽으로 한 번 훑으며 아래쪽 껍질을, 오른쪽에서 왼쪽으로 
+        한 번 훑으며 위쪽 껍질을 만든다. 그레이엄 스캔과 달리 기준점에 
+        대한 각도로 정렬할 필요가 없으므로, 점을 평행 이동시키거나 정렬할
+        때마다 외적을 계산하지 않아도 된다.
+
+        여기서는 입력 배열을 `scratch`에 복사하여 정렬하며, 비교 함수를 
+        인라인할 수 있도록 `qsort()` 대신 `SORT_DEFINE()`으로 만든 퀵 정렬
+        함수를 사용한다. 정렬이 끝나면 나머지 과정은 선형 시간에 끝난다.
+
+        일직선 위에 있는 점들은 볼록 껍질에서 제외하며, 볼록 껍질의 점들은
+        X 좌표가 가장 작은 점부터 반시계 방향 (Y축이 위를 향할 때)으로 
+        `result`에 저장된다.
+    */
+
+    memcpy(scratch, points, n * sizeof *points);
+
+    monotone_chain_points_quick_sort(scratch, n);
+
+    int count = 0;
+
+    // 아래쪽 껍질을 만든다.
+    for (int i = 0; i < n; i++) {
+        while (count >= 2 
+            && monotone_chain_cross(result[count - 2], result[count - 1], scratch[i]) <= 0.0)
+            count--;
+
+        result[count++] = scratch[i];
+    }
+
+    /*
+        위쪽 껍질을 만든다. 가장 왼쪽 점과 가장 오른쪽 점을 잇는 직선보다
+        위에 있는 점만 확인하면, 아래쪽 껍질의 점을 다시 추가하지 않으므로 
+        `result`에는 최대 `n`개의 점만 저장된다. (첫 번째 점은 아래쪽 
+        껍질에 이미 있으므로, 마지막에 다시 추가하지 않는다.)
+    */
+    for (int i = n - 2, lower_count = count + 1; i >= 0; i--) {
+        if (i > 0 && monotone_chain_cross(scratch[0], scratch[n - 1], scratch[i]) <= 0.0)
+            continue;
+
+        while (count >= lower_count 
+            && monotone_chain_cross(result[count - 2], result[count - 1], scratch[i]) <= 0.0)
+            count--;
+
+        if (i > 0) result[count++] = scratch[i];
+    }
+
+    return (count < 3) ? 0 : count;
+}
+
+#endif // `MONOTONE_CHAIN_IMPLEMENTATION`
\ No newline at end of file
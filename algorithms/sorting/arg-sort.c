@@ -0,0 +1,43 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#define ARG_SORT_IMPLEMENTATION
+#include "arg-sort.h"
+
+/* `valgrind --tool=memcheck --leak-check=yes --show-reachable=yes --num-callers=20 ./bin/arg-sort.out` */
+
+int main(void) {
+    T values[] = { 50, 40, 20, 30, 10, 80, 60, 90, 70 };
+
+    size_t length = sizeof(values) / sizeof(*values);
+
+    size_t indices[sizeof(values) / sizeof(*values)];
+
+    if (!arg_sort(values, length, indices)) return 1;
+
+    for (int i = 0; i < length - 1; i++)
+        printf("%d (%zu), ", values[indices[i]], indices[i]);
+
+    printf("%d (%zu)\n", values[indices[length - 1]], indices[length - 1]);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,272 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef ARG_SORT_H
+#define ARG_SORT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* | 매크로 정의... | */
+
+/* 병합 정렬의 첫 단계에서 삽입 정렬할 런의 크기. */
+#define ARG_SORT_RUN_SIZE  32
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 키의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 
+    키 배열을 안정 정렬했을 때의 순서를 `indices`에 저장한다. 
+    (`keys[indices[0]]`가 가장 작은 키가 되며, 키 배열은 바꾸지 않는다.)
+
+    메모리 공간을 할당할 수 없다면, `false`를 반환한다.
+*/
+bool arg_sort(const T *keys, size_t n, size_t *indices);
+
+/* 
+    `arg_sort()`로 구한 순서대로, 크기가 `stride` 바이트인 레코드 `n`개를 
+    제자리에서 옮긴다. (`indices`의 내용은 지워진다.)
+*/
+void arg_sort_apply(void *payload, size_t n, size_t stride, size_t *indices);
+
+/* 키 배열을 안정 정렬하면서, 각 키에 대응하는 레코드도 같은 순서로 옮긴다. */
+void key_payload_sort(T *keys, void *payload, size_t n, size_t stride);
+
+#endif // `ARG_SORT_H`
+
+#ifdef ARG_SORT_IMPLEMENTATION
+
+#ifdef SORT_LESS_DEFAULT
+
+#ifndef RADIX_SORT_IMPLEMENTATION
+#define RADIX_SORT_IMPLEMENTATION
+#endif
+
+#include "radix-sort.h"
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 키와 그 키의 원래 위치를 나타내는 구조체. */
+typedef struct ArgSortPair {
+    T key;          // 키.
+    size_t index;   // 키의 원래 위치.
+} ArgSortPair;
+
+/* | 라이브러리 함수... | */
+
+/* 키와 위치의 쌍으로 이루어진 배열을 상향식으로 병합 정렬한다. */
+static void arg_sort_pairs(ArgSortPair *pairs, ArgSortPair *aux, size_t n) {
+    // 작은 런은 삽입 정렬로 정렬한다.
+    for (size_t low = 0; low < n; low += ARG_SORT_RUN_SIZE) {
+        size_t high = (n - low < ARG_SORT_RUN_SIZE) ? n : low + ARG_SORT_RUN_SIZE;
+
+        for (size_t i = low + 1; i < high; i++) {
+            ArgSortPair pair = pairs[i];
+
+            size_t j = i;
+
+            for (; j > low && SORT_LESS(pair.key, pairs[j - 1].key); j--)
+                pairs[j] = pairs[j - 1];
+
+            pairs[j] = pair;
+        }
+    }
+
+    ArgSortPair *src = pairs, *dst = aux;
+
+    // 두 배열을 번갈아 가며, 인접한 런끼리 합친다.
+    for (size_t width = ARG_SORT_RUN_SIZE; width < n; width *= 2) {
+        for (size_t low = 0; low < n; low += 2 * width) {
+            size_t mid = (n - low < width) ? n : low + width;
+            size_t high = (n - mid < width) ? n : mid + width;
+
+            size_t i = low, j = mid, k = low;
+
+            while (i < mid && j < high)
+                dst[k++] = SORT_LESS(src[j].key, src[i].key) ? src[j++] : src[i++];
+
+            memcpy(dst + k, src + i, (mid - i) * sizeof *dst);
+            memcpy(dst + k + (mid - i), src + j, (high - j) * sizeof *dst);
+        }
+
+        ArgSortPair *temp = src;
+
+        src = dst;
+        dst = temp;
+    }
+
+    if (src != pairs) memcpy(pairs, src, n * sizeof *pairs);
+}
+
+/* 
+    `indices`가 나타내는 순서대로 키와 레코드를 제자리에서 옮긴다.
+
+    `i`번째 자리에 와야 할 원소는 `indices[i]`번째 원소이므로, 이 관계를 
+    따라가면 여러 개의 순환 (cycle)이 만들어진다. 각 순환마다 첫 번째 
+    원소만 임시 공간에 저장해 두고 나머지 원소를 한 칸씩 당기면, 모든 
+    원소를 정확히 한 번씩만 옮기게 된다.
+*/
+static void arg_sort_permute(T *keys, char *payload, size_t n, size_t stride, size_t *indices) {
+    char *temp = NULL;
+
+    if (payload != NULL && stride > 0) {
+        temp = malloc(stride);
+
+        if (temp == NULL) return;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        if (indices[i] == i) continue;
+
+        T key;
+
+        if (keys != NULL) key = keys[i];
+        if (temp != NULL) memcpy(temp, payload + i * stride, stride);
+
+        size_t j = i;
+
+        for (;;) {
+            size_t k = indices[j];
+
+            // 이미 옮긴 원소는 제자리에 있는 것으로 표시한다.
+            indices[j] = j;
+
+            if (k == i) break;
+
+            if (keys != NULL) keys[j] = keys[k];
+            if (temp != NULL) memcpy(payload + j * stride, payload + k * stride, stride);
+
+            j = k;
+        }
+
+        if (keys != NULL) keys[j] = key;
+        if (temp != NULL) memcpy(payload + j * stride, temp, stride);
+    }
+
+    free(temp);
+}
+
+/* 
+    키 배열을 안정 정렬했을 때의 순서를 `indices`에 저장한다. 
+    (`keys[indices[0]]`가 가장 작은 키가 되며, 키 배열은 바꾸지 않는다.)
+
+    메모리 공간을 할당할 수 없다면, `false`를 반환한다.
+*/
+bool arg_sort(const T *keys, size_t n, size_t *indices) {
+    if (keys == NULL || indices == NULL) return false;
+
+    if (n == 0) return true;
+
+    /*
+        크기가 큰 레코드를 정렬할 때 레코드를 직접 옮기면, 원소를 맞바꿀
+        때마다 많은 양의 메모리를 복사해야 한다. 대신 키와 원래 위치의 
+        쌍만 작은 배열에 모아서 정렬하면, 캐시에 더 많은 원소가 들어가고
+        복사하는 양도 줄어든다. 레코드는 마지막에 한 번만 옮기면 된다.
+
+        기본 비교 연산자를 사용한다면, 키와 위치를 하나의 64비트 정수로 
+        묶어 기수 정렬한다. 위쪽 32비트에는 부호 비트를 뒤집은 키를, 
+        아래쪽 32비트에는 위치를 저장하므로, 정수의 대소 관계가 곧 
+        (키, 위치)의 사전식 순서가 되어 정렬의 안정성도 유지된다.
+    */
+
+#ifdef SORT_LESS_DEFAULT
+    if (n <= UINT32_MAX) {
+        uint64_t *packed = malloc(n * sizeof *packed);
+
+        if (packed == NULL) return false;
+
+        for (size_t i = 0; i < n; i++)
+            packed[i] = ((uint64_t) ((uint32_t) keys[i] ^ 0x80000000u) << 32) | i;
+
+        radix_sort_u64(packed, n);
+
+        for (size_t i = 0; i < n; i++)
+            indices[i] = (size_t) (packed[i] & 0xFFFFFFFFu);
+
+        free(packed);
+
+        return true;
+    }
+#endif
+
+    ArgSortPair *pairs = malloc(2 * n * sizeof *pairs);
+
+    if (pairs == NULL) return false;
+
+    for (size_t i = 0; i < n; i++)
+        pairs[i] = (ArgSortPair) { .key = keys[i], .index = i };
+
+    arg_sort_pairs(pairs, pairs + n, n);
+
+    for (size_t i = 0; i < n; i++)
+        indices[i] = pairs[i].index;
+
+    free(pairs);
+
+    return true;
+}
+
+/* 
+    `arg_sort()`로 구한 순서대로, 크기가 `stride` 바이트인 레코드 `n`개를 
+    제자리에서 옮긴다. (`indices`의 내용은 지워진다.)
+*/
+void arg_sort_apply(void *payload, size_t n, size_t stride, size_t *indices) {
+    if (payload == NULL || indices == NULL || n <= 1) return;
+
+    arg_sort_permute(NULL, payload, n, stride, indices);
+}
+
+/* 키 배열을 안정 정렬하면서, 각 키에 대응하는 레코드도 같은 순서로 옮긴다. */
+void key_payload_sort(T *keys, void *payload, size_t n, size_t stride) {
+    if (keys == NULL || n <= 1) return;
+
+    size_t *indices = malloc(n * sizeof *indices);
+
+    if (indices == NULL) return;
+
+    // 순서를 구하지 못했다면, 키와 레코드를 옮기지 않는다.
+    if (arg_sort(keys, n, indices))
+        arg_sort_permute(keys, payload, n, stride, indices);
+
+    free(indices);
+}
+
+#endif // `ARG_SORT_IMPLEMENTATION`
\ No newline at end of file
@@ -0,0 +1,431 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "sort-bench.h"
+
+#include "../sort-random.h"
+
+#ifdef SORT_PROFILE
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#endif
+
+/* `./bin/sort-bench.out [최대 배열 크기] [알고리즘 이름] > bench_output.txt` */
+
+/*
+    `make bench SORT_PROFILE=1`로 빌드하면, 정렬 함수를 한 번 더 실행하면서
+    Linux의 `perf_event_open()`으로 하드웨어 성능 카운터 (사이클, 명령어, 
+    분기 예측 실패, L1 데이터 캐시 및 LLC 읽기 실패 횟수)를 측정하여 
+    CSV의 열로 함께 출력한다. 커널이나 가상 머신이 지원하지 않는 카운터는
+    빈 칸으로 출력한다.
+*/
+
+/* | 매크로 정의... | */
+
+/* 배열의 최대 크기. */
+#define BENCH_MAX_N          100000000
+
+/* 하나의 측정에 사용할 최소 시간 (ns). */
+#define BENCH_MIN_TIME_NS    50000000ULL
+
+/* 하나의 측정에서 정렬을 반복할 최대 횟수. */
+#define BENCH_MAX_REPEATS    1000
+
+/* | 자료형 선언 및 정의... | */
+
+/* 벤치마크할 정렬 알고리즘을 나타내는 구조체. */
+typedef struct Algorithm {
+    const char *name;  // 알고리즘의 이름.
+    SortFunc func;     // 실행 시간을 측정할 정렬 함수.
+    SortFunc counted;  // 비교 및 교환 횟수를 셀 정렬 함수.
+    size_t max_n;      // 알고리즘에 적용할 배열의 최대 크기.
+} Algorithm;
+
+/* 입력 배열의 분포를 나타내는 구조체. */
+typedef struct Distribution {
+    const char *name;                           // 분포의 이름.
+    void (*generate)(T *values, size_t n);      // 입력 배열 생성 함수.
+} Distribution;
+
+#ifdef SORT_PROFILE
+
+/* 하드웨어 성능 카운터를 나타내는 구조체. */
+typedef struct ProfileCounter {
+    const char *name;  // CSV에 출력할 열의 이름.
+    uint32_t type;     // 카운터의 종류.
+    uint64_t config;   // 카운터의 설정 값.
+} ProfileCounter;
+
+/* 하드웨어 성능 카운터에서 읽은 값. (`read_format`의 순서를 따른다.) */
+typedef struct ProfileValue {
+    uint64_t count;         // 카운터의 값.
+    uint64_t time_enabled;  // 카운터가 활성화되어 있던 시간.
+    uint64_t time_running;  // 카운터가 실제로 하드웨어에서 측정한 시간.
+} ProfileValue;
+
+#endif
+
+/* | 전역 변수 정의... | */
+
+unsigned long long sort_bench_comparisons = 0;
+unsigned long long sort_bench_swaps = 0;
+
+/* 입력 배열 생성에 사용할 난수 생성기. */
+static SortRandom bench_rng;
+
+#define SORT_BENCH_ENTRY(name, max_n)  { #name, name, counted_##name, max_n },
+
+static const Algorithm algorithms[] = {
+    SORT_BENCH_ALGORITHMS(SORT_BENCH_ENTRY)
+};
+
+#undef SORT_BENCH_ENTRY
+
+#ifdef SORT_PROFILE
+
+/* 캐시 읽기 실패 횟수를 세는 카운터의 설정 값을 만든다. */
+#define PROFILE_CACHE_READ_MISSES(cache)  \
+    ((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static const ProfileCounter profile_counters[] = {
+    { "cycles",        PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES                       },
+    { "instructions",  PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS                     },
+    { "branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES                    },
+    { "l1d_misses",    PERF_TYPE_HW_CACHE, PROFILE_CACHE_READ_MISSES(PERF_COUNT_HW_CACHE_L1D) },
+    { "llc_misses",    PERF_TYPE_HW_CACHE, PROFILE_CACHE_READ_MISSES(PERF_COUNT_HW_CACHE_LL)  }
+};
+
+#define PROFILE_COUNTER_COUNT  (sizeof profile_counters / sizeof *profile_counters)
+
+/* 각 카운터의 파일 디스크립터. (열지 못한 카운터는 -1) */
+static int profile_fds[PROFILE_COUNTER_COUNT];
+
+#endif
+
+/* | 라이브러리 함수... | */
+
+/* 다음 난수를 반환한다. */
+static uint64_t bench_next(void) {
+    return sort_random_next(&bench_rng);
+}
+
+/* `[0, n)` 범위의 난수를 반환한다. */
+static size_t bench_range(size_t n) {
+    return (size_t) sort_random_range(&bench_rng, n);
+}
+
+/* 무작위로 배열을 생성한다. */
+static void generate_random(T *values, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        values[i] = (T) bench_next();
+}
+
+/* 오름차순으로 정렬된 배열을 생성한다. */
+static void generate_sorted(T *values, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        values[i] = (T) i;
+}
+
+/* 내림차순으로 정렬된 배열을 생성한다. */
+static void generate_reverse(T *values, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        values[i] = (T) (n - i);
+}
+
+/* 절반은 오름차순, 나머지 절반은 내림차순인 배열을 생성한다. */
+static void generate_organ_pipe(T *values, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        values[i] = (T) ((i < n / 2) ? i : n - i);
+}
+
+/* 서로 다른 값이 16개뿐인 배열을 생성한다. */
+static void generate_few_unique(T *values, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        values[i] = (T) bench_range(16);
+}
+
+/* 원소의 1%만 제자리를 벗어난, 거의 정렬된 배열을 생성한다. */
+static void generate_nearly_sorted(T *values, size_t n) {
+    generate_sorted(values, n);
+
+    for (size_t k = 0; k <= n / 100; k++) {
+        size_t i = bench_range(n), j = bench_range(n);
+
+        T value = values[i];
+
+        values[i] = values[j];
+        values[j] = value;
+    }
+}
+
+static const Distribution distributions[] = {
+    { "random",        generate_random        },
+    { "sorted",        generate_sorted        },
+    { "reverse",       generate_reverse       },
+    { "organ-pipe",    generate_organ_pipe    },
+    { "few-unique",    generate_few_unique    },
+    { "nearly-sorted", generate_nearly_sorted }
+};
+
+#ifdef SORT_PROFILE
+
+/* 하드웨어 성능 카운터들을 연다. */
+static void profile_open(void) {
+    for (size_t i = 0; i < PROFILE_COUNTER_COUNT; i++) {
+        struct perf_event_attr attr;
+
+        memset(&attr, 0, sizeof attr);
+
+        attr.size = sizeof attr;
+        attr.type = profile_counters[i].type;
+        attr.config = profile_counters[i].config;
+
+        /*
+            하드웨어 카운터가 부족하면 커널이 카운터들을 번갈아 가며 측정하므로,
+            실제로 측정한 시간도 함께 읽어서 값을 보정한다.
+        */
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        // 사용자 공간에서 실행된 코드만 세며, 병렬 정렬 함수가 만드는 스레드도 함께 센다.
+        attr.disabled = 1;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        profile_fds[i] = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+}
+
+/* 하드웨어 성능 카운터들을 닫는다. */
+static void profile_close(void) {
+    for (size_t i = 0; i < PROFILE_COUNTER_COUNT; i++)
+        if (profile_fds[i] >= 0) close(profile_fds[i]);
+}
+
+/* 
+    주어진 정렬 함수를 한 번 실행하면서 하드웨어 성능 카운터를 측정하고, 
+    그 결과를 CSV의 열로 출력한다.
+*/
+static void profile_run(SortFunc func, T *values, size_t n) {
+    ProfileValue before[PROFILE_COUNTER_COUNT];
+
+    int readable[PROFILE_COUNTER_COUNT];
+
+    /*
+        `PERF_EVENT_IOC_RESET`은 카운터의 값만 초기화하고 시간은 초기화하지 
+        않으므로, 정렬 함수를 실행하기 전의 시간을 읽어 두었다가 뺀다.
+    */
+    for (size_t i = 0; i < PROFILE_COUNTER_COUNT; i++) {
+        readable[i] = 0;
+
+        if (profile_fds[i] < 0) continue;
+
+        ioctl(profile_fds[i], PERF_EVENT_IOC_RESET, 0);
+
+        readable[i] = read(profile_fds[i], &before[i], sizeof before[i]) == sizeof before[i];
+
+        ioctl(profile_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    func(values, n);
+
+    for (size_t i = 0; i < PROFILE_COUNTER_COUNT; i++)
+        if (profile_fds[i] >= 0) ioctl(profile_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+
+    for (size_t i = 0; i < PROFILE_COUNTER_COUNT; i++) {
+        ProfileValue after;
+
+        if (!readable[i] || read(profile_fds[i], &after, sizeof after) != sizeof after) {
+            printf(",");
+
+            continue;
+        }
+
+        const uint64_t enabled = after.time_enabled - before[i].time_enabled;
+        const uint64_t running = after.time_running - before[i].time_running;
+
+        // 카운터가 한 번도 측정되지 않았다면, 값을 알 수 없다.
+        if (running == 0) {
+            printf(",");
+
+            continue;
+        }
+
+        // 일부 시간 동안만 측정되었다면, 전체 시간에 대한 값으로 보정한다.
+        if (running < enabled)
+            after.count = (uint64_t) ((double) after.count * enabled / running + 0.5);
+
+        printf(",%llu", (unsigned long long) after.count);
+    }
+}
+
+#endif
+
+/* 현재 시간을 반환한다. (ns) */
+static unsigned long long get_time_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (unsigned long long) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+/* 주어진 배열의 모든 원소의 합을 반환한다. */
+static unsigned long long get_checksum(const T *values, size_t n) {
+    unsigned long long result = 0;
+
+    for (size_t i = 0; i < n; i++)
+        result += (unsigned long long) values[i];
+
+    return result;
+}
+
+/* 주어진 배열이 정렬되어 있는지 확인한다. */
+static int is_sorted(const T *values, size_t n) {
+    for (size_t i = 1; i < n; i++)
+        if (values[i] < values[i - 1]) return 0;
+
+    return 1;
+}
+
+/* 주어진 알고리즘과 입력 배열의 분포에 대한 벤치마크를 실행한다. */
+static int run_benchmark(const Algorithm *a, const Distribution *d, T *source, T *work, size_t n) {
+    // 같은 조건에서는 항상 같은 입력 배열이 생성되도록 한다.
+    sort_random_init(&bench_rng, n * 0x100000001B3ULL + (d - distributions));
+
+    d->generate(source, n);
+
+    unsigned long long checksum = get_checksum(source, n);
+    unsigned long long elapsed = 0;
+
+    int repeats = 0;
+
+    // 측정 시간이 너무 짧으면 정렬을 여러 번 반복한다.
+    do {
+        memcpy(work, source, n * sizeof *work);
+
+        unsigned long long begin = get_time_ns();
+
+        a->func(work, n);
+
+        elapsed += get_time_ns() - begin;
+
+        repeats++;
+    } while (elapsed < BENCH_MIN_TIME_NS && repeats < BENCH_MAX_REPEATS);
+
+    if (!is_sorted(work, n) || get_checksum(work, n) != checksum) {
+        fprintf(stderr, "sort-bench: `%s` failed on `%s` (n = %zu)\n", a->name, d->name, n);
+
+        return 0;
+    }
+
+    // 비교 및 교환 횟수는 따로 한 번만 센다.
+    memcpy(work, source, n * sizeof *work);
+
+    sort_bench_comparisons = sort_bench_swaps = 0;
+
+    a->counted(work, n);
+
+    printf(
+        "%s,%s,%zu,%.3f,%llu,%llu",
+        a->name,
+        d->name,
+        n,
+        (double) elapsed / ((double) repeats * n),
+        sort_bench_comparisons,
+        sort_bench_swaps
+    );
+
+#ifdef SORT_PROFILE
+    memcpy(work, source, n * sizeof *work);
+
+    profile_run(a->func, work, n);
+#endif
+
+    printf("\n");
+
+    fflush(stdout);
+
+    return 1;
+}
+
+int main(int argc, char *argv[]) {
+    size_t max_n = BENCH_MAX_N;
+
+    if (argc > 1) max_n = strtoull(argv[1], NULL, 10);
+    if (max_n < 100 || max_n > BENCH_MAX_N) max_n = BENCH_MAX_N;
+
+    const char *filter = (argc > 2) ? argv[2] : NULL;
+
+    T *source = malloc(max_n * sizeof *source);
+    T *work = malloc(max_n * sizeof *work);
+
+    if (source == NULL || work == NULL) {
+        fprintf(stderr, "sort-bench: failed to allocate %zu elements\n", max_n);
+
+        free(source);
+        free(work);
+
+        return 1;
+    }
+
+    int result = 0;
+
+    printf("algorithm,distribution,n,ns_per_element,comparisons,swaps");
+
+#ifdef SORT_PROFILE
+    profile_open();
+
+    for (size_t i = 0; i < PROFILE_COUNTER_COUNT; i++)
+        printf(",%s", profile_counters[i].name);
+#endif
+
+    printf("\n");
+
+    for (size_t i = 0; i < sizeof algorithms / sizeof *algorithms; i++) {
+        const Algorithm *a = &algorithms[i];
+
+        if (filter != NULL && strstr(a->name, filter) == NULL) continue;
+
+        for (size_t j = 0; j < sizeof distributions / sizeof *distributions; j++)
+            for (size_t n = 100; n <= max_n && n <= a->max_n; n *= 10)
+                if (!run_benchmark(a, &distributions[j], source, work, n))
+                    result = 1;
+    }
+
+#ifdef SORT_PROFILE
+    profile_close();
+#endif
+
+    free(source);
+    free(work);
+
+    return result;
+}
\ No newline at end of file
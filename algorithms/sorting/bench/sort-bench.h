@@ -0,0 +1,88 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SORT_BENCH_H
+#define SORT_BENCH_H
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* | 매크로 정의... | */
+
+/*
+    벤치마크할 정렬 알고리즘의 목록.
+
+    `X(이름, 최대 배열 크기)` 형식으로 작성하며, 시간 복잡도가 `O(n^2)`인
+    알고리즘은 배열의 크기를 작게 제한한다. 새로운 정렬 알고리즘을 추가할
+    때는 `sort-kernels.c`의 이름 변경 목록에도 함께 추가해야 한다.
+
+    함수의 형식이 `SortFunc`와 다른 알고리즘은 `sort-kernels.c`에 
+    감싸는 함수를 따로 정의하여 등록한다.
+*/
+#define SORT_BENCH_ALGORITHMS(X)        \
+    X(bubble_sort,    10000)            \
+    X(insertion_sort, 10000)            \
+    X(selection_sort, 10000)            \
+    X(shell_sort,     10000000)         \
+    X(merge_sort,     100000000)        \
+    X(merge_sort_bottom_up_reuse, 100000000) \
+    X(merge_sort_parallel_all, 100000000) \
+    X(tim_sort,       100000000)        \
+    X(block_merge_sort, 100000000)      \
+    X(heap_sort,      100000000)        \
+    X(quick_sort,     100000000)        \
+    X(sort_define_quick_sort, 100000000) \
+    X(sort_define_merge_sort, 100000000) \
+    X(pdq_sort,       100000000)        \
+    X(radix_sort,     100000000)        \
+    X(counting_sort,  100000000)        \
+    X(counting_sort_stable, 100000000)  \
+    X(sort_auto,      100000000)        \
+    X(sample_sort_parallel_all, 100000000)
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* 정렬 함수의 자료형. */
+typedef void (*SortFunc)(T *values, size_t n);
+
+/* | 전역 변수 선언... | */
+
+/* 원소 비교 횟수. */
+extern unsigned long long sort_bench_comparisons;
+
+/* 원소 교환 횟수. */
+extern unsigned long long sort_bench_swaps;
+
+/* | 라이브러리 함수... | */
+
+#define SORT_BENCH_DECLARE(name, max_n)   \
+    void name(T *values, size_t n);       \
+    void counted_##name(T *values, size_t n);
+
+SORT_BENCH_ALGORITHMS(SORT_BENCH_DECLARE)
+
+#undef SORT_BENCH_DECLARE
+
+#endif // `SORT_BENCH_H`
\ No newline at end of file
@@ -0,0 +1,183 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+/*
+    이 파일은 두 번 컴파일된다. 한 번은 그대로 컴파일하여 실행 시간을
+    측정하는 데 사용하고, 다른 한 번은 `SORT_BENCH_COUNTED`를 정의하여
+    비교 및 교환 횟수를 세는 `counted_*` 함수들을 만드는 데 사용한다.
+
+    이렇게 하면 실행 시간을 측정할 때 횟수를 세는 코드의 영향을 받지 않는다.
+    여러 개의 스레드를 사용하는 정렬 알고리즘도 있으므로, 횟수를 셀 때는
+    원자적 연산을 사용한다.
+*/
+
+#include <unistd.h>
+
+#ifdef SORT_BENCH_COUNTED
+
+/* | 전역 변수 선언... | */
+
+extern unsigned long long sort_bench_comparisons;
+extern unsigned long long sort_bench_swaps;
+
+/* | 매크로 정의... | */
+
+#define SORT_BENCH_COUNT(counter)  __atomic_fetch_add(&(counter), 1, __ATOMIC_RELAXED)
+
+#define SORT_LESS(a, b)  (SORT_BENCH_COUNT(sort_bench_comparisons), (a) < (b))
+#define SORT_SWAP(a, b)  do { T _value = (a); (a) = (b); (b) = _value; SORT_BENCH_COUNT(sort_bench_swaps); } while (0)
+
+/* 
+    횟수를 세더라도 정수를 그대로 비교하므로, 실행 시간을 측정할 때와 
+    같이 병합 정렬에서 정렬 네트워크를 사용한다.
+*/
+#define MERGE_SORT_NETWORK
+
+#define sorting_network_sort  counted_sorting_network_sort
+#define bubble_sort     counted_bubble_sort
+#define insertion_sort  counted_insertion_sort
+#define selection_sort  counted_selection_sort
+#define shell_sort      counted_shell_sort
+#define merge_sort      counted_merge_sort
+#define merge_sort_bottom_up  counted_merge_sort_bottom_up
+#define merge_sort_bottom_up_reuse  counted_merge_sort_bottom_up_reuse
+#define merge_sort_parallel   counted_merge_sort_parallel
+#define merge_sort_parallel_all  counted_merge_sort_parallel_all
+#define tim_sort        counted_tim_sort
+#define block_merge_sort  counted_block_merge_sort
+#define heap_sort       counted_heap_sort
+#define quick_sort      counted_quick_sort
+#define quick_select    counted_quick_select
+#define partial_sort    counted_partial_sort
+#define pdq_sort        counted_pdq_sort
+#define radix_sort      counted_radix_sort
+#define radix_sort_u32  counted_radix_sort_u32
+#define radix_sort_u64  counted_radix_sort_u64
+#define radix_sort_i32  counted_radix_sort_i32
+#define radix_sort_i64  counted_radix_sort_i64
+#define radix_sort_f32  counted_radix_sort_f32
+#define radix_sort_f64  counted_radix_sort_f64
+#define counting_sort   counted_counting_sort
+#define counting_sort_stable  counted_counting_sort_stable
+#define sort_auto       counted_sort_auto
+#define sample_sort_parallel  counted_sample_sort_parallel
+#define sample_sort_parallel_all  counted_sample_sort_parallel_all
+#define sort_define_quick_sort    counted_sort_define_quick_sort
+#define sort_define_merge_sort    counted_sort_define_merge_sort
+
+#endif
+
+#define BUBBLE_SORT_IMPLEMENTATION
+#include "../bubble-sort.h"
+
+#define INSERTION_SORT_IMPLEMENTATION
+#include "../insertion-sort.h"
+
+#define SELECTION_SORT_IMPLEMENTATION
+#include "../selection-sort.h"
+
+#define SHELL_SORT_IMPLEMENTATION
+#include "../shell-sort.h"
+
+#define MERGE_SORT_IMPLEMENTATION
+#include "../merge-sort.h"
+
+#define MERGE_SORT_PARALLEL_IMPLEMENTATION
+#include "../merge-sort-parallel.h"
+
+#define TIM_SORT_IMPLEMENTATION
+#include "../tim-sort.h"
+
+#define BLOCK_MERGE_SORT_IMPLEMENTATION
+#include "../block-merge-sort.h"
+
+#define HEAP_SORT_IMPLEMENTATION
+#include "../heap-sort.h"
+
+#define QUICK_SORT_IMPLEMENTATION
+#include "../quick-sort.h"
+
+#define PDQ_SORT_IMPLEMENTATION
+#include "../pdq-sort.h"
+
+#define RADIX_SORT_IMPLEMENTATION
+#include "../radix-sort.h"
+
+#define COUNTING_SORT_IMPLEMENTATION
+#include "../counting-sort.h"
+
+#define SORT_AUTO_IMPLEMENTATION
+#include "../sort-auto.h"
+
+#define SAMPLE_SORT_IMPLEMENTATION
+#include "../sample-sort.h"
+
+#include "../sort-define.h"
+
+/* `SORT_LESS`를 비교 식으로 사용하면, 비교 횟수도 함께 셀 수 있다. */
+SORT_DEFINE(bench, T, SORT_LESS(a, b))
+
+/* | 라이브러리 함수... | */
+
+/* 사용 가능한 CPU 코어의 개수를 반환한다. 개수를 알 수 없다면, 1을 반환한다. */
+static int bench_threads(void) {
+    const long result = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (result < 1) ? 1 : (int) result;
+}
+
+/* 임시 메모리 공간을 재사용하면서, 주어진 배열을 상향식으로 병합 정렬한다. */
+void merge_sort_bottom_up_reuse(T *values, size_t n) {
+    static T *aux = NULL;
+    static size_t capacity = 0;
+
+    if (capacity < n) {
+        T *new_aux = realloc(aux, n * sizeof *new_aux);
+
+        if (new_aux == NULL) return;
+
+        aux = new_aux;
+        capacity = n;
+    }
+
+    merge_sort_bottom_up(values, n, aux);
+}
+
+/* 사용 가능한 모든 CPU 코어를 이용하여, 주어진 배열을 병합 정렬한다. */
+void merge_sort_parallel_all(T *values, size_t n) {
+    merge_sort_parallel(values, n, bench_threads());
+}
+
+/* 사용 가능한 모든 CPU 코어를 이용하여, 주어진 배열을 샘플 정렬한다. */
+void sample_sort_parallel_all(T *values, size_t n) {
+    sample_sort_parallel(values, n, bench_threads());
+}
+
+/* `SORT_DEFINE()`으로 만든 퀵 정렬 함수로, 주어진 배열을 정렬한다. */
+void sort_define_quick_sort(T *values, size_t n) {
+    bench_quick_sort(values, n);
+}
+
+/* `SORT_DEFINE()`으로 만든 병합 정렬 함수로, 주어진 배열을 정렬한다. */
+void sort_define_merge_sort(T *values, size_t n) {
+    bench_merge_sort(values, n);
+}
\ No newline at end of file
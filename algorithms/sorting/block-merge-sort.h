@@ -0,0 +1,741 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef BLOCK_MERGE_SORT_H
+#define BLOCK_MERGE_SORT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* | 매크로 정의... | */
+
+/* 
+    블록 병합 정렬에 사용할 스택 버퍼의 크기. 
+    
+    0으로 설정하면 추가 메모리 공간을 전혀 사용하지 않지만, 원소를 복사하는 
+    대신 맞바꿔야 하기 때문에 조금 느려진다.
+*/
+#ifndef BLOCK_MERGE_SORT_BUFFER_SIZE
+#define BLOCK_MERGE_SORT_BUFFER_SIZE  512
+#endif
+
+/* 삽입 정렬을 사용할 배열의 최대 크기. */
+#define BLOCK_MERGE_SORT_INSERTION_THRESHOLD  16
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 배열을 추가 메모리 공간 없이 안정적으로 블록 병합 정렬한다. */
+void block_merge_sort(T *values, size_t n);
+
+#endif // `BLOCK_MERGE_SORT_H`
+
+#ifdef BLOCK_MERGE_SORT_IMPLEMENTATION
+
+/* | 라이브러리 함수... | */
+
+/* 두 원소의 위치를 맞바꾼다. */
+static inline void block_merge_sort_swap(T *a, T *b) {
+    T value = *a;
+
+    *a = *b;
+    *b = value;
+}
+
+/* 크기가 `n`인 두 부분 배열의 위치를 맞바꾼다. */
+static inline void block_merge_sort_swap_n(T *a, T *b, ptrdiff_t n) {
+    while (n-- > 0) block_merge_sort_swap(a++, b++);
+}
+
+/* 인접한 두 부분 배열 `[0, l1)`과 `[l1, l1 + l2)`의 위치를 맞바꾼다. */
+static void block_merge_sort_rotate(T *a, ptrdiff_t l1, ptrdiff_t l2) {
+    while (l1 > 0 && l2 > 0) {
+        if (l1 <= l2) {
+            block_merge_sort_swap_n(a, a + l1, l1);
+
+            a += l1, l2 -= l1;
+        } else {
+            block_merge_sort_swap_n(a + (l1 - l2), a + l1, l2);
+
+            l1 -= l2;
+        }
+    }
+}
+
+/* 정렬된 배열에서 `key`가 들어갈 가장 왼쪽 위치를 찾는다. */
+static ptrdiff_t block_merge_sort_search_left(const T *a, ptrdiff_t len, T key) {
+    ptrdiff_t low = -1, high = len;
+
+    while (low < high - 1) {
+        ptrdiff_t mid = low + ((high - low) >> 1);
+
+        if (!SORT_LESS(a[mid], key)) high = mid;
+        else low = mid;
+    }
+
+    return high;
+}
+
+/* 정렬된 배열에서 `key`가 들어갈 가장 오른쪽 위치를 찾는다. */
+static ptrdiff_t block_merge_sort_search_right(const T *a, ptrdiff_t len, T key) {
+    ptrdiff_t low = -1, high = len;
+
+    while (low < high - 1) {
+        ptrdiff_t mid = low + ((high - low) >> 1);
+
+        if (SORT_LESS(key, a[mid])) high = mid;
+        else low = mid;
+    }
+
+    return high;
+}
+
+/* 주어진 배열을 삽입 정렬한다. */
+static void block_merge_sort_insertion(T *a, ptrdiff_t len) {
+    for (ptrdiff_t i = 1; i < len; i++)
+        for (ptrdiff_t j = i - 1; j >= 0 && SORT_LESS(a[j + 1], a[j]); j--)
+            block_merge_sort_swap(&a[j], &a[j + 1]);
+}
+
+/* 
+    배열의 앞쪽에서 서로 다른 값을 가진 원소 (키)를 최대 `count`개 찾아서, 
+    정렬된 상태로 배열의 맨 앞에 모은다. 찾은 키의 개수를 반환한다.
+*/
+static ptrdiff_t block_merge_sort_find_keys(T *a, ptrdiff_t len, ptrdiff_t count) {
+    // 키는 `[h0, h0 + h)` 구간에 정렬된 상태로 모아 둔다.
+    ptrdiff_t h = 1, h0 = 0;
+
+    for (ptrdiff_t u = 1; u < len && h < count; u++) {
+        ptrdiff_t r = block_merge_sort_search_left(a + h0, h, a[u]);
+
+        // 같은 값을 가진 키가 없다면, 키를 `u`번째 원소의 바로 앞으로 옮긴 다음 추가한다.
+        if (r == h || SORT_LESS(a[u], a[h0 + r])) {
+            block_merge_sort_rotate(a + h0, h, u - (h0 + h));
+
+            h0 = u - h;
+
+            block_merge_sort_rotate(a + (h0 + r), h - r, 1);
+
+            h++;
+        }
+    }
+
+    block_merge_sort_rotate(a, h0, h);
+
+    return h;
+}
+
+/* 
+    인접한 두 부분 배열 `[0, len1)`과 `[len1, len1 + len2)`를 추가 메모리 공간 
+    없이 회전 연산만으로 합친다. (`O(min(len1, len2)^2 + max(len1, len2))`)
+*/
+static void block_merge_sort_merge_in_place(T *a, ptrdiff_t len1, ptrdiff_t len2) {
+    if (len1 < len2) {
+        while (len1 > 0) {
+            ptrdiff_t h = block_merge_sort_search_left(a + len1, len2, a[0]);
+
+            if (h != 0) {
+                block_merge_sort_rotate(a, len1, h);
+
+                a += h, len2 -= h;
+            }
+
+            if (len2 == 0) break;
+
+            do {
+                a++, len1--;
+            } while (len1 > 0 && !SORT_LESS(a[len1], a[0]));
+        }
+    } else {
+        while (len2 > 0) {
+            ptrdiff_t h = block_merge_sort_search_right(a, len1, a[len1 + len2 - 1]);
+
+            if (h != len1) {
+                block_merge_sort_rotate(a + h, len1 - h, len2);
+
+                len1 = h;
+            }
+
+            if (len1 == 0) break;
+
+            do {
+                len2--;
+            } while (len2 > 0 && !SORT_LESS(a[len1 + len2 - 1], a[len1 - 1]));
+        }
+    }
+}
+
+/* 
+    두 부분 배열 `[0, l1)`과 `[l1, l1 + l2)`를 합쳐서 `[m, m + l1 + l2)`에 저장한다.
+    (`m < 0`이며, `[m, 0)`은 내부 버퍼로 사용하므로 원소를 복사하는 대신 맞바꾼다.)
+*/
+static void block_merge_sort_merge_left(T *a, ptrdiff_t l1, ptrdiff_t l2, ptrdiff_t m) {
+    ptrdiff_t p0 = 0, p1 = l1;
+
+    l2 += l1;
+
+    while (p1 < l2) {
+        if (p0 == l1 || SORT_LESS(a[p1], a[p0])) block_merge_sort_swap(&a[m++], &a[p1++]);
+        else block_merge_sort_swap(&a[m++], &a[p0++]);
+    }
+
+    if (m != p0) block_merge_sort_swap_n(a + m, a + p0, l1 - p0);
+}
+
+/* 
+    두 부분 배열 `[0, l1)`과 `[l1, l1 + l2)`를 합쳐서 `[m, m + l1 + l2)`에 저장한다.
+    (`m > 0`이며, 배열의 뒤쪽에서부터 채워 나간다.)
+*/
+static void block_merge_sort_merge_right(T *a, ptrdiff_t l1, ptrdiff_t l2, ptrdiff_t m) {
+    ptrdiff_t p0 = l1 + l2 + m - 1, p2 = l1 + l2 - 1, p1 = l1 - 1;
+
+    while (p1 >= 0) {
+        if (p2 < l1 || SORT_LESS(a[p2], a[p1])) block_merge_sort_swap(&a[p0--], &a[p1--]);
+        else block_merge_sort_swap(&a[p0--], &a[p2--]);
+    }
+
+    if (p2 != p0)
+        while (p2 >= l1) block_merge_sort_swap(&a[p0--], &a[p2--]);
+}
+
+/* 
+    `x`가 `y`보다 먼저 와야 하는지 확인한다. 
+
+    `inverted`가 참이면, 값이 같을 때도 `x`가 먼저 온다. (`x`가 앞쪽 
+    부분 배열에서 왔다면, 안정성을 위해 같은 값도 먼저 와야 한다.)
+*/
+static inline bool block_merge_sort_before(T x, T y, int inverted) {
+    return inverted ? !SORT_LESS(y, x) : SORT_LESS(x, y);
+}
+
+/* 
+    남은 원소들 `[0, *len1)` (종류 `*type`)과 다음 블록 `[*len1, *len1 + len2)`를 
+    내부 버퍼 `[-lkeys, 0)`를 이용하여 합친다. 다 합치지 못하고 남은 원소의 
+    개수와 종류를 `*len1`과 `*type`에 저장한다.
+*/
+static void block_merge_sort_smart_merge(T *a, ptrdiff_t *len1, int *type, ptrdiff_t len2, ptrdiff_t lkeys) {
+    ptrdiff_t p0 = -lkeys, p1 = 0, p2 = *len1, q1 = p2, q2 = p2 + len2;
+
+    int inverted = 1 - *type;
+
+    while (p1 < q1 && p2 < q2) {
+        if (block_merge_sort_before(a[p1], a[p2], inverted)) block_merge_sort_swap(&a[p0++], &a[p1++]);
+        else block_merge_sort_swap(&a[p0++], &a[p2++]);
+    }
+
+    if (p1 < q1) {
+        *len1 = q1 - p1;
+
+        while (p1 < q1) block_merge_sort_swap(&a[--q1], &a[--q2]);
+    } else {
+        *len1 = q2 - p2;
+        *type = inverted;
+    }
+}
+
+/* `block_merge_sort_smart_merge()`와 같지만, 내부 버퍼 없이 회전 연산으로 합친다. */
+static void block_merge_sort_smart_merge_in_place(T *a, ptrdiff_t *len1_ptr, int *type, ptrdiff_t len2) {
+    if (len2 == 0) return;
+
+    ptrdiff_t len1 = *len1_ptr;
+
+    int inverted = 1 - *type;
+
+    if (len1 > 0 && !block_merge_sort_before(a[len1 - 1], a[len1], inverted)) {
+        while (len1 > 0) {
+            ptrdiff_t h = inverted 
+                ? block_merge_sort_search_left(a + len1, len2, a[0]) 
+                : block_merge_sort_search_right(a + len1, len2, a[0]);
+
+            if (h != 0) {
+                block_merge_sort_rotate(a, len1, h);
+
+                a += h, len2 -= h;
+            }
+
+            if (len2 == 0) {
+                *len1_ptr = len1;
+
+                return;
+            }
+
+            do {
+                a++, len1--;
+            } while (len1 > 0 && block_merge_sort_before(a[0], a[len1], inverted));
+        }
+    }
+
+    *len1_ptr = len2;
+    *type = inverted;
+}
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+
+/* `block_merge_sort_merge_left()`와 같지만, `[m, 0)`의 원소를 보존하지 않고 덮어쓴다. */
+static void block_merge_sort_merge_left_copy(T *a, ptrdiff_t l1, ptrdiff_t l2, ptrdiff_t m) {
+    ptrdiff_t p0 = 0, p1 = l1;
+
+    l2 += l1;
+
+    while (p1 < l2) {
+        if (p0 == l1 || SORT_LESS(a[p1], a[p0])) a[m++] = a[p1++];
+        else a[m++] = a[p0++];
+    }
+
+    if (m != p0)
+        while (p0 < l1) a[m++] = a[p0++];
+}
+
+/* `block_merge_sort_smart_merge()`와 같지만, 원소를 맞바꾸는 대신 복사한다. */
+static void block_merge_sort_smart_merge_copy(T *a, ptrdiff_t *len1, int *type, ptrdiff_t len2, ptrdiff_t lkeys) {
+    ptrdiff_t p0 = -lkeys, p1 = 0, p2 = *len1, q1 = p2, q2 = p2 + len2;
+
+    int inverted = 1 - *type;
+
+    while (p1 < q1 && p2 < q2) {
+        if (block_merge_sort_before(a[p1], a[p2], inverted)) a[p0++] = a[p1++];
+        else a[p0++] = a[p2++];
+    }
+
+    if (p1 < q1) {
+        *len1 = q1 - p1;
+
+        while (p1 < q1) a[--q2] = a[--q1];
+    } else {
+        *len1 = q2 - p2;
+        *type = inverted;
+    }
+}
+
+#endif
+
+/* 
+    키 순서대로 정렬된 `count`개의 블록 (크기 `lblock`)을 합친다. 
+
+    `keys[i]`는 `i`번째 블록이 원래 어느 쪽 부분 배열에 있었는지를 나타내며,
+    `midkey`보다 작으면 앞쪽, 크거나 같으면 뒤쪽 부분 배열의 블록이다. 블록 
+    뒤에는 앞쪽 부분 배열의 블록 `count2`개와, 크기가 `llast`인 마지막 블록이 
+    있다. `mode`가 0이면 내부 버퍼 없이, 1이면 내부 버퍼 `[-lblock, 0)`과 원소를
+    맞바꾸며, 2이면 내부 버퍼에 원소를 복사하며 합친다.
+*/
+static void block_merge_sort_merge_blocks(const T *keys, T midkey, T *a, ptrdiff_t count, ptrdiff_t lblock, 
+                                          int mode, ptrdiff_t count2, ptrdiff_t llast) {
+    if (count == 0) {
+        ptrdiff_t l = count2 * lblock;
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+        if (mode == 2) block_merge_sort_merge_left_copy(a, l, llast, -lblock);
+        else
+#endif
+        if (mode == 1) block_merge_sort_merge_left(a, l, llast, -lblock);
+        else block_merge_sort_merge_in_place(a, l, llast);
+
+        return;
+    }
+
+    ptrdiff_t lrest = lblock, prest, pidx = lblock;
+
+    int frest = SORT_LESS(keys[0], midkey) ? 0 : 1;
+
+    for (ptrdiff_t cidx = 1; cidx < count; cidx++, pidx += lblock) {
+        prest = pidx - lrest;
+
+        int fnext = SORT_LESS(keys[cidx], midkey) ? 0 : 1;
+
+        // 같은 쪽 부분 배열에서 온 블록이라면, 남은 원소들은 이미 제자리에 있다.
+        if (fnext == frest) {
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+            if (mode == 2) memmove(a + prest - lblock, a + prest, lrest * sizeof *a);
+            else
+#endif
+            if (mode == 1) block_merge_sort_swap_n(a + prest - lblock, a + prest, lrest);
+
+            lrest = lblock;
+        } else {
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+            if (mode == 2) block_merge_sort_smart_merge_copy(a + prest, &lrest, &frest, lblock, lblock);
+            else
+#endif
+            if (mode == 1) block_merge_sort_smart_merge(a + prest, &lrest, &frest, lblock, lblock);
+            else block_merge_sort_smart_merge_in_place(a + prest, &lrest, &frest, lblock);
+        }
+    }
+
+    prest = pidx - lrest;
+
+    if (llast > 0) {
+        if (frest) {
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+            if (mode == 2) memmove(a + prest - lblock, a + prest, lrest * sizeof *a);
+            else
+#endif
+            if (mode == 1) block_merge_sort_swap_n(a + prest - lblock, a + prest, lrest);
+
+            prest = pidx;
+            lrest = lblock * count2;
+            frest = 0;
+        } else {
+            lrest += lblock * count2;
+        }
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+        if (mode == 2) block_merge_sort_merge_left_copy(a + prest, lrest, llast, -lblock);
+        else
+#endif
+        if (mode == 1) block_merge_sort_merge_left(a + prest, lrest, llast, -lblock);
+        else block_merge_sort_merge_in_place(a + prest, lrest, llast);
+    } else {
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+        if (mode == 2) memmove(a + prest - lblock, a + prest, lrest * sizeof *a);
+        else
+#endif
+        if (mode == 1) block_merge_sort_swap_n(a + prest, a + (prest - lblock), lrest);
+    }
+}
+
+/* 
+    `keys`를 키로 사용하여, 정렬된 부분 배열 (크기 `ll`)들을 두 개씩 합친다.
+
+    각 부분 배열을 크기가 `lblock`인 블록으로 나누고, 블록의 첫 번째 원소를
+    기준으로 블록을 선택 정렬한 다음, 인접한 블록끼리 합친다. 블록을 옮길 
+    때마다 키도 함께 옮기므로, 키를 보면 각 블록이 원래 어느 쪽 부분 배열에 
+    있었는지 알 수 있다.
+*/
+static void block_merge_sort_combine(T *keys, T *a, ptrdiff_t len, ptrdiff_t ll, ptrdiff_t lblock, bool has_buffer, T *xbuf) {
+    ptrdiff_t m = len / (2 * ll), lrest = len % (2 * ll);
+
+    if (lrest <= ll) len -= lrest, lrest = 0;
+
+    int mode = has_buffer ? 1 : 0;
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE == 0
+    // 스택 버퍼를 사용하지 않으므로, `xbuf`는 항상 `NULL`이다.
+    (void) xbuf;
+#endif
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+    if (xbuf != NULL) {
+        memcpy(xbuf, a - lblock, lblock * sizeof *a);
+
+        mode = 2;
+    }
+#endif
+
+    for (ptrdiff_t b = 0; b <= m; b++) {
+        if (b == m && lrest == 0) break;
+
+        T *a1 = a + b * 2 * ll;
+
+        ptrdiff_t count = ((b == m) ? lrest : 2 * ll) / lblock;
+
+        block_merge_sort_insertion(keys, count + ((b == m) ? 1 : 0));
+
+        ptrdiff_t midkey = ll / lblock;
+
+        // 블록의 첫 번째 원소를 기준으로 블록을 선택 정렬한다. (값이 같으면 키를 비교한다.)
+        for (ptrdiff_t u = 1; u < count; u++) {
+            ptrdiff_t p = u - 1;
+
+            for (ptrdiff_t v = u; v < count; v++) {
+                if (SORT_LESS(a1[v * lblock], a1[p * lblock]) 
+                    || (!SORT_LESS(a1[p * lblock], a1[v * lblock]) && SORT_LESS(keys[v], keys[p])))
+                    p = v;
+            }
+
+            if (p != u - 1) {
+                block_merge_sort_swap_n(a1 + (u - 1) * lblock, a1 + p * lblock, lblock);
+                block_merge_sort_swap(&keys[u - 1], &keys[p]);
+
+                if (midkey == u - 1 || midkey == p) midkey ^= (u - 1) ^ p;
+            }
+        }
+
+        ptrdiff_t count2 = 0, llast = 0;
+
+        // 마지막 블록보다 큰 블록들은, 마지막 블록과 직접 합친다.
+        if (b == m) llast = lrest % lblock;
+
+        if (llast != 0)
+            while (count2 < count && SORT_LESS(a1[count * lblock], a1[(count - count2 - 1) * lblock]))
+                count2++;
+
+        block_merge_sort_merge_blocks(keys, keys[midkey], a1, count - count2, lblock, mode, count2, llast);
+    }
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+    if (xbuf != NULL) {
+        for (ptrdiff_t p = len; --p >= 0; )
+            a[p] = a[p - lblock];
+
+        memcpy(a - lblock, xbuf, lblock * sizeof *a);
+
+        return;
+    }
+#endif
+
+    // 내부 버퍼를 다시 부분 배열의 앞쪽으로 옮긴다.
+    if (has_buffer)
+        while (--len >= 0) block_merge_sort_swap(&a[len], &a[len - lblock]);
+}
+
+/* 
+    `[-k, 0)`을 내부 버퍼로 사용하여, 배열을 크기가 `2 * k`인 부분 배열 단위로 
+    정렬한다. 정렬이 끝나면 내부 버퍼는 배열의 맨 앞으로 돌아온다.
+*/
+static void block_merge_sort_build(T *a, ptrdiff_t len, ptrdiff_t k, T *xbuf, ptrdiff_t xbuf_len) {
+    ptrdiff_t h, kbuf = (k < xbuf_len) ? k : xbuf_len;
+
+    // 스택 버퍼에서 사용할 크기는 2의 거듭제곱으로 맞춘다.
+    while (kbuf & (kbuf - 1)) kbuf &= kbuf - 1;
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE == 0
+    // 스택 버퍼를 사용하지 않으므로, `xbuf`는 항상 `NULL`이다.
+    (void) xbuf;
+#endif
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+    if (kbuf > 0) {
+        memcpy(xbuf, a - kbuf, kbuf * sizeof *a);
+
+        for (ptrdiff_t m = 1; m < len; m += 2) {
+            int u = SORT_LESS(a[m], a[m - 1]) ? 1 : 0;
+
+            a[m - 3] = a[m - 1 + u];
+            a[m - 2] = a[m - u];
+        }
+
+        if (len % 2) a[len - 3] = a[len - 1];
+
+        a -= 2;
+
+        for (h = 2; h < kbuf; h *= 2) {
+            ptrdiff_t p0 = 0, p1 = len - 2 * h;
+
+            for (; p0 <= p1; p0 += 2 * h)
+                block_merge_sort_merge_left_copy(a + p0, h, h, -h);
+
+            ptrdiff_t rest = len - p0;
+
+            if (rest > h) block_merge_sort_merge_left_copy(a + p0, h, rest - h, -h);
+            else for (; p0 < len; p0++) a[p0 - h] = a[p0];
+
+            a -= h;
+        }
+
+        memcpy(a + len, xbuf, kbuf * sizeof *a);
+    } else
+#endif
+    {
+        // 인접한 두 원소를 정렬하면서, 내부 버퍼와 맞바꾼다.
+        for (ptrdiff_t m = 1; m < len; m += 2) {
+            int u = SORT_LESS(a[m], a[m - 1]) ? 1 : 0;
+
+            block_merge_sort_swap(&a[m - 3], &a[m - 1 + u]);
+            block_merge_sort_swap(&a[m - 2], &a[m - u]);
+        }
+
+        if (len % 2) block_merge_sort_swap(&a[len - 1], &a[len - 3]);
+
+        a -= 2;
+
+        h = 2;
+    }
+
+    for (; h < k; h *= 2) {
+        ptrdiff_t p0 = 0, p1 = len - 2 * h;
+
+        for (; p0 <= p1; p0 += 2 * h)
+            block_merge_sort_merge_left(a + p0, h, h, -h);
+
+        ptrdiff_t rest = len - p0;
+
+        if (rest > h) block_merge_sort_merge_left(a + p0, h, rest - h, -h);
+        else block_merge_sort_rotate(a + p0 - h, h, rest);
+
+        a -= h;
+    }
+
+    // 내부 버퍼를 다시 배열의 맨 앞으로 옮기면서, 크기가 `2 * k`인 부분 배열을 만든다.
+    ptrdiff_t restk = len % (2 * k), p = len - restk;
+
+    if (restk <= k) block_merge_sort_rotate(a + p, restk, k);
+    else block_merge_sort_merge_right(a + p, k, restk - k, k);
+
+    while (p > 0) {
+        p -= 2 * k;
+
+        block_merge_sort_merge_right(a + p, k, k, k);
+    }
+}
+
+/* 키가 부족할 때, 회전 연산만으로 주어진 배열을 병합 정렬한다. */
+static void block_merge_sort_lazy(T *a, ptrdiff_t len) {
+    for (ptrdiff_t m = 1; m < len; m += 2)
+        if (SORT_LESS(a[m], a[m - 1])) block_merge_sort_swap(&a[m - 1], &a[m]);
+
+    for (ptrdiff_t h = 2; h < len; h *= 2) {
+        ptrdiff_t p0 = 0, p1 = len - 2 * h;
+
+        for (; p0 <= p1; p0 += 2 * h)
+            block_merge_sort_merge_in_place(a + p0, h, h);
+
+        ptrdiff_t rest = len - p0;
+
+        if (rest > h) block_merge_sort_merge_in_place(a + p0, h, rest - h);
+    }
+}
+
+/* 주어진 배열을 추가 메모리 공간 없이 안정적으로 블록 병합 정렬한다. */
+void block_merge_sort(T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        블록 병합 정렬은 병합 정렬과 같이 `O(n * log n)`의 시간 복잡도를 
+        가지는 안정 정렬 알고리즘이지만, 크기가 `n`인 임시 메모리 공간 
+        대신 배열의 일부를 내부 버퍼로 사용한다. 여기서는 GrailSort의 
+        방법을 이용한다.
+
+        1. 배열의 앞쪽에서 서로 다른 값을 가진 원소 약 `2 * sqrt(n)`개를 
+           찾아서 맨 앞으로 모은다. 이 중 절반은 내부 버퍼로, 나머지 
+           절반은 블록의 원래 위치를 기억하는 키로 사용한다. 서로 다른 
+           값을 가진 원소끼리는 순서가 바뀌어도 안정성이 깨지지 않는다.
+        2. 내부 버퍼와 원소를 맞바꾸는 방식으로 병합하면, 버퍼의 원소들은
+           순서만 섞일 뿐 사라지지 않는다. 이를 이용하여 작은 부분 배열을
+           만든다.
+        3. 두 부분 배열을 합칠 때는 각 부분 배열을 크기가 `sqrt(n)`인 
+           블록으로 나누고, 블록의 첫 번째 원소를 기준으로 블록을 정렬한 
+           다음, 인접한 블록끼리만 내부 버퍼를 이용하여 합친다.
+        4. 마지막으로 내부 버퍼와 키를 정렬하여, 나머지 배열과 회전 
+           연산으로 합친다.
+
+        서로 다른 값이 너무 적어서 키를 충분히 찾지 못하면, 내부 버퍼 
+        없이 회전 연산으로 블록을 합친다. 또한, 스택에 작은 버퍼를 두면 
+        원소를 맞바꾸는 대신 복사할 수 있어 더 빨라진다.
+    */
+
+    ptrdiff_t len = (ptrdiff_t) n;
+
+    if (len < BLOCK_MERGE_SORT_INSERTION_THRESHOLD) {
+        block_merge_sort_insertion(values, len);
+
+        return;
+    }
+
+#if BLOCK_MERGE_SORT_BUFFER_SIZE > 0
+    T xbuf[BLOCK_MERGE_SORT_BUFFER_SIZE];
+
+    ptrdiff_t xbuf_len = BLOCK_MERGE_SORT_BUFFER_SIZE;
+#else
+    T *xbuf = NULL;
+
+    ptrdiff_t xbuf_len = 0;
+#endif
+
+    ptrdiff_t lblock = 1;
+
+    while (lblock * lblock < len) lblock *= 2;
+
+    ptrdiff_t nkeys = (len - 1) / lblock + 1;
+
+    ptrdiff_t found = block_merge_sort_find_keys(values, len, nkeys + lblock);
+
+    bool has_buffer = true;
+
+    // 키가 부족하다면, 내부 버퍼 없이 정렬한다.
+    if (found < nkeys + lblock) {
+        if (found < 4) {
+            block_merge_sort_lazy(values, len);
+
+            return;
+        }
+
+        nkeys = lblock;
+
+        while (nkeys > found) nkeys /= 2;
+
+        has_buffer = false;
+
+        lblock = 0;
+    }
+
+    ptrdiff_t ptr = lblock + nkeys, cbuf = has_buffer ? lblock : nkeys;
+
+    if (has_buffer) block_merge_sort_build(values + ptr, len - ptr, cbuf, xbuf, xbuf_len);
+    else block_merge_sort_build(values + ptr, len - ptr, cbuf, NULL, 0);
+
+    // 크기가 `2 * cbuf`인 부분 배열들을 두 개씩 합치는 과정을 반복한다.
+    while (len - ptr > (cbuf *= 2)) {
+        ptrdiff_t lb = lblock;
+
+        bool chas_buffer = has_buffer;
+
+        if (!has_buffer) {
+            if (nkeys > 4 && nkeys / 8 * nkeys >= cbuf) {
+                // 키의 절반을 내부 버퍼로 사용한다.
+                lb = nkeys / 2;
+
+                chas_buffer = true;
+            } else {
+                ptrdiff_t nk = 1;
+
+                long long s = (long long) cbuf * found / 2;
+
+                while (nk < nkeys && s != 0) nk *= 2, s /= 8;
+
+                lb = (2 * cbuf) / nk;
+            }
+        }
+
+        block_merge_sort_combine(
+            values, 
+            values + ptr, 
+            len - ptr, 
+            cbuf, 
+            lb, 
+            chas_buffer, 
+            (chas_buffer && lb <= xbuf_len) ? xbuf : NULL
+        );
+    }
+
+    // 내부 버퍼와 키를 정렬하여, 나머지 배열과 합친다.
+    block_merge_sort_insertion(values, ptr);
+    block_merge_sort_merge_in_place(values, ptr, len - ptr);
+}
+
+#endif // `BLOCK_MERGE_SORT_IMPLEMENTATION`
\ No newline at end of file
@@ -26,6 +26,25 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+/* | 매크로 정의... | */
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+#ifndef SORT_SWAP
+
+/* 두 원소의 위치를 맞바꾼다. */
+#define SORT_SWAP(a, b)  do { T _value = (a); (a) = (b); (b) = _value; } while (0)
+
+#endif
+
 /* | 자료형 선언 및 정의... | */
 
 /* 정렬할 원소의 자료형. */
@@ -53,12 +72,8 @@ void bubble_sort(T *values, size_t n) {
 
     for (int i = 0; i < n; i++)
         for (int j = 0; j < n - 1; j++)
-            if (values[j] > values[j + 1]) {
-                T value = values[j];
-
-                values[j] = values[j + 1];
-                values[j + 1] = value;
-            }
+            if (SORT_LESS(values[j + 1], values[j]))
+                SORT_SWAP(values[j], values[j + 1]);
 }
 
 #endif // `BUBBLE_SORT_IMPLEMENTATION`
\ No newline at end of file
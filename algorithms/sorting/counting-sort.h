@@ -0,0 +1,267 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef COUNTING_SORT_H
+#define COUNTING_SORT_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "merge-sort.h"
+#include "pdq-sort.h"
+
+/* | 매크로 정의... | */
+
+/* 계수 정렬을 사용할 키 범위의 최대 크기. */
+#define COUNTING_SORT_MAX_RANGE  (1 << 20)
+
+#ifndef COUNTING_SORT_KEY
+
+/* 
+    원소에서 정수 키를 꺼낸다. 
+
+    `T`가 구조체라면 키 필드를 꺼내도록 다시 정의하고, `SORT_LESS`도 같은 
+    키를 비교하도록 정의해야 한다. (키 범위가 너무 넓으면 비교 기반 정렬을 
+    사용하기 때문이다.)
+*/
+#define COUNTING_SORT_KEY(value)  (value)
+
+/* `COUNTING_SORT_KEY`가 원소를 그대로 키로 사용하는지 여부. */
+#define COUNTING_SORT_KEY_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 배열을 계수 정렬한다. */
+void counting_sort(T *values, size_t n);
+
+/* 주어진 배열을 안정적으로 계수 정렬한다. */
+void counting_sort_stable(T *values, size_t n);
+
+#endif // `COUNTING_SORT_H`
+
+#if defined(COUNTING_SORT_IMPLEMENTATION) && !defined(COUNTING_SORT_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define COUNTING_SORT_IMPLEMENTED
+
+#ifndef MERGE_SORT_IMPLEMENTATION
+#define MERGE_SORT_IMPLEMENTATION
+#endif
+
+#include "merge-sort.h"
+
+#ifndef PDQ_SORT_IMPLEMENTATION
+#define PDQ_SORT_IMPLEMENTATION
+#endif
+
+#include "pdq-sort.h"
+
+/* | 라이브러리 함수... | */
+
+/* 
+    배열을 한 번만 읽어서 가장 작은 키를 `*min`에 저장하고, 키 범위의 크기를 
+    반환한다. 키 범위가 너무 넓어서 계수 정렬을 사용할 수 없다면 0을 반환한다.
+*/
+static size_t counting_sort_range(const T *values, size_t n, long long *min) {
+    long long low = COUNTING_SORT_KEY(values[0]), high = low;
+
+    for (size_t i = 1; i < n; i++) {
+        long long key = COUNTING_SORT_KEY(values[i]);
+
+        if (key < low) low = key;
+        if (key > high) high = key;
+    }
+
+    // 키의 차이는 `long long`의 범위를 넘을 수 있으므로, 부호 없는 정수로 계산한다.
+    unsigned long long span = (unsigned long long) high - (unsigned long long) low;
+
+    // 키 범위가 배열의 크기보다 크면, 히스토그램을 만드는 비용이 더 커진다.
+    if (span >= COUNTING_SORT_MAX_RANGE || span >= n) return 0;
+
+    *min = low;
+
+    return (size_t) span + 1;
+}
+
+/* 주어진 배열을 계수 정렬한다. */
+void counting_sort(T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        계수 정렬은 원소끼리 비교하는 대신, 각 키를 가진 원소의 개수를 
+        센 다음 그 개수만큼 원소를 제자리에 놓는 정렬 알고리즘이다. 
+        키 범위의 크기가 `k`일 때 시간 복잡도는 `O(n + k)`이므로, 상태 
+        코드나 버킷 번호처럼 값의 범위가 좁은 배열에서는 비교 기반 정렬 
+        알고리즘보다 훨씬 빠르다.
+
+        먼저 배열을 한 번 읽어서 키의 최솟값과 최댓값을 구하고, 키 
+        범위가 배열의 크기보다 작을 때만 계수 정렬을 사용한다. 그렇지 
+        않으면 패턴 무력화 퀵 정렬로 정렬한다.
+
+        원소를 그대로 키로 사용한다면, 원소의 개수만 세어 두었다가 배열을 
+        다시 채우면 된다. 그렇지 않으면 각 키의 시작 위치를 구한 다음, 
+        원소를 제자리로 옮기는 순환을 따라가며 서로 맞바꾼다. (American
+        flag sort) 어느 쪽이든 추가 메모리 공간은 키 범위에만 비례하지만,
+        같은 키를 가진 원소들의 순서는 유지되지 않는다.
+    */
+
+    long long min;
+
+    size_t range = counting_sort_range(values, n, &min);
+
+    if (range == 0) {
+        pdq_sort(values, n);
+
+        return;
+    }
+
+#ifdef COUNTING_SORT_KEY_DEFAULT
+    size_t *counts = calloc(range, sizeof *counts);
+
+    if (counts == NULL) {
+        pdq_sort(values, n);
+
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++)
+        counts[(size_t) (values[i] - min)]++;
+
+    // 각 키를 가진 원소의 개수만큼 배열을 다시 채운다.
+    for (size_t k = 0, i = 0; k < range; k++)
+        for (size_t c = counts[k]; c > 0; c--)
+            values[i++] = (T) (min + (long long) k);
+
+    free(counts);
+#else
+    // `starts[k]`부터 `starts[k + 1]`까지가 `k`번째 키의 자리이다.
+    size_t *starts = calloc(2 * range + 1, sizeof *starts), *heads = starts + range + 1;
+
+    if (starts == NULL) {
+        pdq_sort(values, n);
+
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++)
+        starts[(size_t) (COUNTING_SORT_KEY(values[i]) - min) + 1]++;
+
+    for (size_t k = 0; k < range; k++) {
+        starts[k + 1] += starts[k];
+
+        heads[k] = starts[k];
+    }
+
+    // 자리를 잘못 잡은 원소를 제자리로 옮기고, 그 자리에 있던 원소를 다시 옮기는 과정을 반복한다.
+    for (size_t k = 0; k < range; k++) {
+        while (heads[k] < starts[k + 1]) {
+            T value = values[heads[k]];
+
+            size_t b = (size_t) (COUNTING_SORT_KEY(value) - min);
+
+            while (b != k) {
+                T next = values[heads[b]];
+
+                values[heads[b]++] = value;
+
+                value = next;
+
+                b = (size_t) (COUNTING_SORT_KEY(value) - min);
+            }
+
+            values[heads[k]++] = value;
+        }
+    }
+
+    free(starts);
+#endif
+}
+
+/* 주어진 배열을 안정적으로 계수 정렬한다. */
+void counting_sort_stable(T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        안정적인 계수 정렬은 각 키를 가진 원소의 개수를 센 다음, 개수의 
+        누적 합 (prefix sum)으로 각 키의 시작 위치를 구하고, 배열을 
+        앞에서부터 읽으며 원소를 임시 메모리 공간의 제자리로 옮긴다. 
+        같은 키를 가진 원소들은 원래 순서대로 놓이므로, 구조체 배열을 
+        정수 키로 정렬할 때 유용하다.
+
+        키 범위가 넓으면, 같은 임시 메모리 공간을 이용하여 상향식으로 
+        병합 정렬한다.
+    */
+
+    T *aux = malloc(n * sizeof *aux);
+
+    if (aux == NULL) {
+        merge_sort_bottom_up(values, n, NULL);
+
+        return;
+    }
+
+    long long min;
+
+    size_t range = counting_sort_range(values, n, &min);
+
+    size_t *starts = (range > 0) ? calloc(range, sizeof *starts) : NULL;
+
+    if (starts == NULL) {
+        merge_sort_bottom_up(values, n, aux);
+
+        free(aux);
+
+        return;
+    }
+
+    for (size_t i = 0; i < n; i++)
+        starts[(size_t) (COUNTING_SORT_KEY(values[i]) - min)]++;
+
+    // 각 키의 시작 위치를 계산한다.
+    size_t offset = 0;
+
+    for (size_t k = 0; k < range; k++) {
+        size_t count = starts[k];
+
+        starts[k] = offset;
+        offset += count;
+    }
+
+    for (size_t i = 0; i < n; i++)
+        aux[starts[(size_t) (COUNTING_SORT_KEY(values[i]) - min)]++] = values[i];
+
+    memcpy(values, aux, n * sizeof *values);
+
+    free(starts);
+    free(aux);
+}
+
+#endif // `COUNTING_SORT_IMPLEMENTATION`
\ No newline at end of file
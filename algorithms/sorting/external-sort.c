@@ -0,0 +1,66 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#define EXTERNAL_SORT_IMPLEMENTATION
+#include "external-sort.h"
+
+/* `valgrind --tool=memcheck --leak-check=yes --show-reachable=yes --num-callers=20 ./bin/external-sort.out` */
+
+int main(void) {
+    T values[] = { 50, 40, 20, 30, 10, 80, 60, 90, 70 };
+
+    size_t length = sizeof(values) / sizeof(*values);
+
+    const char *path = "external-sort.bin";
+
+    FILE *fp = fopen(path, "wb");
+
+    if (fp == NULL) return 1;
+
+    fwrite(values, sizeof(*values), length, fp);
+    fclose(fp);
+
+    // 원소를 4개까지만 메모리에 올리고, 런을 2개씩 합치도록 설정한다.
+    ExternalSortConfig config = { .memory_limit = 4 * sizeof(T), .fan_in = 2 };
+
+    if (!external_sort(path, path, &config)) {
+        remove(path);
+
+        return 1;
+    }
+
+    fp = fopen(path, "rb");
+
+    if (fp == NULL) return 1;
+
+    length = fread(values, sizeof(*values), length, fp);
+
+    fclose(fp);
+    remove(path);
+
+    for (int i = 0; i < length - 1; i++)
+        printf("%d, ", values[i]);
+
+    printf("%d\n", values[length - 1]);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,418 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* | 매크로 정의... | */
+
+/* 외부 정렬에 사용할 메모리의 기본 크기. (256 MiB) */
+#define EXTERNAL_SORT_DEFAULT_MEMORY_LIMIT  ((size_t) 256 << 20)
+
+/* 한 번에 합칠 런의 기본 개수. */
+#define EXTERNAL_SORT_DEFAULT_FAN_IN        64
+
+/* 임시 파일의 경로에 사용할 버퍼의 크기. */
+#define EXTERNAL_SORT_MAX_PATH              4096
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소 (레코드)의 자료형. */
+typedef int T;
+
+/* 외부 정렬의 설정을 나타내는 구조체. */
+typedef struct ExternalSortConfig {
+    size_t memory_limit;    // 정렬에 사용할 메모리의 최대 크기. (바이트)
+    int fan_in;             // 한 번에 합칠 런의 최대 개수.
+    const char *temp_dir;   // 임시 파일을 만들 디렉토리. (`NULL`이면 `tmpfile()`을 사용한다.)
+} ExternalSortConfig;
+
+/* | 라이브러리 함수... | */
+
+/* 
+    `input_path` 파일에 저장된 원소들을 정렬하여 `output_path` 파일에 저장한다.
+    `config`가 `NULL`이면 기본 설정을 사용한다.
+*/
+bool external_sort(const char *input_path, const char *output_path, const ExternalSortConfig *config);
+
+#endif // `EXTERNAL_SORT_H`
+
+#ifdef EXTERNAL_SORT_IMPLEMENTATION
+
+#include <unistd.h>
+
+#ifndef MERGE_SORT_IMPLEMENTATION
+#define MERGE_SORT_IMPLEMENTATION
+#endif
+
+#include "merge-sort.h"
+
+/* | 자료형 선언 및 정의... | */
+
+/* 합칠 런 하나를 읽어 들이는 스트림을 나타내는 구조체. */
+typedef struct ExternalSortRun {
+    FILE *fp;       // 런이 저장된 파일.
+    T *buffer;      // 파일에서 읽어 온 원소들을 저장할 버퍼.
+    size_t pos;     // 버퍼에서 다음에 꺼낼 원소의 위치.
+    size_t len;     // 버퍼에 저장된 원소의 개수.
+} ExternalSortRun;
+
+/* | 라이브러리 함수... | */
+
+/* 
+    임시 파일을 생성한다.
+
+    임시 파일은 생성하자마자 경로를 지우므로, 파일을 닫거나 프로그램이 
+    종료되면 자동으로 삭제된다.
+*/
+static FILE *external_sort_open_temp(const char *temp_dir) {
+    if (temp_dir == NULL) return tmpfile();
+
+    char path[EXTERNAL_SORT_MAX_PATH];
+
+    int length = snprintf(path, sizeof path, "%s/external-sort-XXXXXX", temp_dir);
+
+    if (length < 0 || length >= (int) sizeof path) return NULL;
+
+    int fd = mkstemp(path);
+
+    if (fd < 0) return NULL;
+
+    unlink(path);
+
+    FILE *fp = fdopen(fd, "w+b");
+
+    if (fp == NULL) close(fd);
+
+    return fp;
+}
+
+/* 주어진 파일들을 모두 닫는다. */
+static void external_sort_close_all(FILE **files, int count) {
+    for (int i = 0; i < count; i++)
+        fclose(files[i]);
+}
+
+/* 런의 버퍼가 비었다면, 파일에서 다음 원소들을 읽어 온다. */
+static bool external_sort_refill(ExternalSortRun *run, size_t capacity) {
+    if (run->pos < run->len) return true;
+
+    run->pos = 0;
+    run->len = fread(run->buffer, sizeof *run->buffer, capacity, run->fp);
+
+    return !ferror(run->fp);
+}
+
+/* 
+    패자 트리에서 `a`번째 런의 현재 원소가 `b`번째 런의 현재 원소보다
+    먼저 와야 하는지 확인한다.
+    
+    `-1`은 트리를 초기화할 때 사용하는 가상의 런으로, 항상 먼저 온다.
+    값이 같다면 앞쪽 런의 원소가 먼저 오므로, 정렬의 안정성이 유지된다.
+*/
+static bool external_sort_before(const ExternalSortRun *runs, int a, int b) {
+    if (a < 0) return true;
+    if (b < 0) return false;
+
+    bool a_done = (runs[a].pos >= runs[a].len);
+    bool b_done = (runs[b].pos >= runs[b].len);
+
+    if (a_done || b_done) return !a_done;
+
+    T x = runs[a].buffer[runs[a].pos], y = runs[b].buffer[runs[b].pos];
+
+    if (SORT_LESS(x, y)) return true;
+    if (SORT_LESS(y, x)) return false;
+
+    return a < b;
+}
+
+/* 
+    `s`번째 런의 현재 원소가 바뀌었을 때, 리프에서 루트까지 올라가며
+    패자 트리를 갱신한다.
+*/
+static void external_sort_adjust(const ExternalSortRun *runs, int *tree, int k, int s) {
+    for (int t = (s + k) / 2; t > 0; t /= 2) {
+        // 각 노드에는 패자를 남기고, 승자만 위로 올라간다.
+        if (external_sort_before(runs, tree[t], s)) {
+            int temp = tree[t];
+
+            tree[t] = s;
+            s = temp;
+        }
+    }
+
+    tree[0] = s;
+}
+
+/* 
+    정렬된 `k`개의 런을 패자 트리로 합쳐서 `out` 파일에 저장한다.
+    
+    `memory`를 `k + 1`개의 같은 크기의 버퍼로 나누어, 각 런을 읽어 오는
+    데에 하나씩, 결과를 쓰는 데에 하나를 사용한다.
+*/
+static bool external_sort_merge(FILE **inputs, int k, FILE *out, T *memory, size_t capacity) {
+    size_t buffer_size = capacity / (k + 1);
+
+    ExternalSortRun *runs = malloc(k * sizeof *runs);
+    int *tree = malloc(k * sizeof *tree);
+
+    bool result = (runs != NULL && tree != NULL);
+
+    for (int i = 0; result && i < k; i++) {
+        runs[i] = (ExternalSortRun) { 
+            .fp = inputs[i], 
+            .buffer = memory + (size_t) i * buffer_size 
+        };
+
+        rewind(runs[i].fp);
+
+        result = external_sort_refill(&runs[i], buffer_size);
+    }
+
+    if (result) {
+        T *output = memory + (size_t) k * buffer_size;
+
+        size_t count = 0;
+
+        // 모든 노드를 가상의 런으로 채운 다음, 각 런을 차례대로 트리에 넣는다.
+        for (int i = 0; i < k; i++)
+            tree[i] = -1;
+
+        for (int s = k - 1; s >= 0; s--)
+            external_sort_adjust(runs, tree, k, s);
+
+        // 승자의 원소가 모두 소진될 때까지, 승자의 원소를 하나씩 꺼낸다.
+        while (result && runs[tree[0]].pos < runs[tree[0]].len) {
+            int w = tree[0];
+
+            output[count++] = runs[w].buffer[runs[w].pos++];
+
+            if (count == buffer_size) {
+                result = (fwrite(output, sizeof *output, count, out) == count);
+
+                count = 0;
+            }
+
+            result = result && external_sort_refill(&runs[w], buffer_size);
+
+            external_sort_adjust(runs, tree, k, w);
+        }
+
+        if (result && count > 0)
+            result = (fwrite(output, sizeof *output, count, out) == count);
+    }
+
+    free(runs);
+    free(tree);
+
+    return result;
+}
+
+/* 
+    `input_path` 파일에 저장된 원소들을 정렬하여 `output_path` 파일에 저장한다.
+    `config`가 `NULL`이면 기본 설정을 사용한다.
+*/
+bool external_sort(const char *input_path, const char *output_path, const ExternalSortConfig *config) {
+    if (input_path == NULL || output_path == NULL) return false;
+
+    /*
+        외부 정렬은 메모리에 한꺼번에 올릴 수 없을 만큼 큰 파일을 정렬할 때
+        사용하는 알고리즘으로, 다음과 같은 과정을 거친다.
+
+        1. 메모리에 올릴 수 있는 만큼 파일을 읽어서 병합 정렬한 다음, 
+           정렬된 런을 임시 파일에 저장한다.
+        2. 최대 `fan_in`개의 런을 패자 트리 (loser tree)로 합쳐서 하나의
+           런으로 만드는 과정을, 런이 하나만 남을 때까지 반복한다.
+
+        패자 트리는 `k`개의 런 중에서 가장 작은 원소를 `O(log k)`번의 
+        비교로 찾을 수 있으며, 힙과 달리 리프에서 루트까지 한 번만 
+        올라가면 되므로 비교 횟수가 더 적다. 또한, 각 런을 큰 버퍼 단위로
+        읽고 쓰기 때문에 하드 디스크에서도 순차 입출력의 성능을 얻을 수
+        있다. 런을 합칠 때 값이 같다면 앞쪽 런의 원소를 먼저 꺼내므로, 
+        외부 정렬은 안정 정렬이 된다.
+    */
+
+    ExternalSortConfig cfg = {
+        .memory_limit = EXTERNAL_SORT_DEFAULT_MEMORY_LIMIT,
+        .fan_in = EXTERNAL_SORT_DEFAULT_FAN_IN
+    };
+
+    if (config != NULL) {
+        if (config->memory_limit > 0) cfg.memory_limit = config->memory_limit;
+        if (config->fan_in > 0) cfg.fan_in = config->fan_in;
+
+        cfg.temp_dir = config->temp_dir;
+    }
+
+    // 원소를 최소 4개는 저장할 수 있어야 한다.
+    size_t capacity = cfg.memory_limit / sizeof(T);
+
+    if (capacity < 4) capacity = 4;
+
+    // 각 런을 읽어 올 버퍼와 결과를 쓸 버퍼에 최소 1개의 원소가 들어가야 한다.
+    if (cfg.fan_in < 2) cfg.fan_in = 2;
+    if ((size_t) cfg.fan_in > capacity - 1) cfg.fan_in = (int) (capacity - 1);
+
+    FILE *in = fopen(input_path, "rb");
+
+    if (in == NULL) return false;
+
+    T *memory = malloc(capacity * sizeof *memory);
+
+    if (memory == NULL) {
+        fclose(in);
+
+        return false;
+    }
+
+    FILE **runs = NULL, *out = NULL;
+
+    int count = 0, max_count = 0;
+
+    bool result = true;
+
+    // 배열의 절반은 정렬할 원소를 저장하는 데에, 나머지 절반은 병합 정렬에 사용한다.
+    size_t chunk_size = capacity / 2;
+
+    for (;;) {
+        size_t n = fread(memory, sizeof *memory, chunk_size, in);
+
+        if (ferror(in)) {
+            result = false;
+
+            break;
+        }
+
+        // 파일 전체가 메모리에 들어간다면, 임시 파일을 거치지 않는다.
+        if (count == 0 && n < chunk_size) {
+            merge_sort_bottom_up(memory, n, memory + chunk_size);
+
+            fclose(in), in = NULL;
+
+            out = fopen(output_path, "wb");
+
+            result = (out != NULL && fwrite(memory, sizeof *memory, n, out) == n);
+
+            break;
+        }
+
+        if (n == 0) break;
+
+        merge_sort_bottom_up(memory, n, memory + chunk_size);
+
+        if (count == max_count) {
+            int new_max_count = (max_count > 0) ? 2 * max_count : 16;
+
+            FILE **new_runs = realloc(runs, new_max_count * sizeof *new_runs);
+
+            if (new_runs == NULL) {
+                result = false;
+
+                break;
+            }
+
+            runs = new_runs, max_count = new_max_count;
+        }
+
+        // 정렬된 런을 임시 파일에 저장한다.
+        FILE *fp = external_sort_open_temp(cfg.temp_dir);
+
+        if (fp == NULL) {
+            result = false;
+
+            break;
+        }
+
+        runs[count++] = fp;
+
+        if (fwrite(memory, sizeof *memory, n, fp) != n) {
+            result = false;
+
+            break;
+        }
+    }
+
+    if (in != NULL) fclose(in);
+
+    // 런의 개수가 `fan_in`개 이하가 될 때까지, 런을 합쳐서 임시 파일에 저장한다.
+    while (result && count > cfg.fan_in) {
+        int new_count = 0;
+
+        for (int i = 0; i < count; i += cfg.fan_in) {
+            int k = (count - i < cfg.fan_in) ? count - i : cfg.fan_in;
+
+            FILE *fp = external_sort_open_temp(cfg.temp_dir);
+
+            if (fp != NULL && !external_sort_merge(runs + i, k, fp, memory, capacity))
+                fclose(fp), fp = NULL;
+
+            external_sort_close_all(runs + i, k);
+
+            if (fp == NULL) {
+                external_sort_close_all(runs + i + k, count - (i + k));
+
+                result = false;
+
+                break;
+            }
+
+            // 합친 런은 원래 런이 있던 자리의 앞쪽에 저장한다.
+            runs[new_count++] = fp;
+        }
+
+        count = new_count;
+    }
+
+    // 남은 런들을 합쳐서 결과 파일에 저장한다.
+    if (result && count > 0) {
+        out = fopen(output_path, "wb");
+
+        result = (out != NULL) && external_sort_merge(runs, count, out, memory, capacity);
+    }
+
+    external_sort_close_all(runs, count);
+
+    if (out != NULL && fclose(out) != 0) result = false;
+
+    free(runs);
+    free(memory);
+
+    return result;
+}
+
+#endif // `EXTERNAL_SORT_IMPLEMENTATION`
\ No newline at end of file
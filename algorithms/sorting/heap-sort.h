@@ -0,0 +1,131 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef HEAP_SORT_H
+#define HEAP_SORT_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* | 매크로 정의... | */
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 배열을 힙 정렬한다. */
+void heap_sort(T *values, size_t n);
+
+#endif // `HEAP_SORT_H`
+
+#if defined(HEAP_SORT_IMPLEMENTATION) && !defined(HEAP_SORT_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define HEAP_SORT_IMPLEMENTED
+
+/* | 라이브러리 함수... | */
+
+/* 
+    `i`번째 위치의 빈 자리에 `value`를 넣어, 크기가 `n`인 최대 힙을 다시 만든다.
+
+    빈 자리를 먼저 더 큰 자식 노드 쪽으로 끝까지 내려보낸 다음, `value`가 
+    들어갈 위치를 아래에서부터 찾아 올라간다. (Floyd)
+*/
+static void heap_sort_sift_down(T *values, size_t i, size_t n, T value) {
+    size_t hole = i, child = 2 * hole + 2;
+
+    // 한 단계마다 두 자식 노드만 비교하며, 빈 자리를 잎 노드까지 내려보낸다.
+    for (; child < n; child = 2 * hole + 2) {
+        if (SORT_LESS(values[child], values[child - 1])) child--;
+
+        values[hole] = values[child];
+
+        hole = child;
+    }
+
+    if (child == n) {
+        values[hole] = values[n - 1];
+
+        hole = n - 1;
+    }
+
+    // `value`보다 작은 부모 노드를 아래로 내리면서, 제자리를 찾아 올라간다.
+    while (hole > i) {
+        size_t parent = (hole - 1) / 2;
+
+        if (!SORT_LESS(values[parent], value)) break;
+
+        values[hole] = values[parent];
+
+        hole = parent;
+    }
+
+    values[hole] = value;
+}
+
+/* 주어진 배열을 힙 정렬한다. */
+void heap_sort(T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        힙 정렬은 배열을 최대 힙으로 만든 다음, 가장 큰 원소를 배열의 
+        끝으로 옮기는 과정을 반복하는 정렬 알고리즘이다. 추가 메모리 
+        공간 없이 항상 `O(n * log n)`의 시간 복잡도를 보장하기 때문에, 
+        퀵 정렬의 순환 호출이 너무 깊어졌을 때 대신 사용하기에 알맞다.
+
+        일반적인 방법으로 원소를 아래로 내려보내면, 한 단계마다 두 
+        자식 노드끼리 한 번, 더 큰 자식 노드와 내려보낼 원소를 한 번 
+        비교해야 한다. 하지만 힙의 맨 끝에서 가져온 원소는 대부분 
+        잎 노드 근처까지 내려가므로, 빈 자리를 먼저 잎 노드까지 
+        내려보낸 다음 원소가 들어갈 위치를 아래에서부터 찾으면 비교 
+        횟수를 거의 절반으로 줄일 수 있다. (bottom-up heapsort)
+    */
+
+    // 최대 힙을 만든다.
+    for (size_t i = n / 2; i > 0; i--)
+        heap_sort_sift_down(values, i - 1, n, values[i - 1]);
+
+    // 가장 큰 원소를 배열의 끝으로 옮기는 과정을 반복한다.
+    for (size_t i = n - 1; i > 0; i--) {
+        T value = values[i];
+
+        values[i] = values[0];
+
+        heap_sort_sift_down(values, 0, i, value);
+    }
+}
+
+#endif // `HEAP_SORT_IMPLEMENTATION`
\ No newline at end of file
@@ -26,6 +26,25 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+/* | 매크로 정의... | */
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+#ifndef SORT_SWAP
+
+/* 두 원소의 위치를 맞바꾼다. */
+#define SORT_SWAP(a, b)  do { T _value = (a); (a) = (b); (b) = _value; } while (0)
+
+#endif
+
 /* | 자료형 선언 및 정의... | */
 
 /* 정렬할 원소의 자료형. */
@@ -38,7 +57,10 @@ void insertion_sort(T *values, size_t n);
 
 #endif // `INSERTION_SORT_H`
 
-#ifdef INSERTION_SORT_IMPLEMENTATION
+#if defined(INSERTION_SORT_IMPLEMENTATION) && !defined(INSERTION_SORT_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define INSERTION_SORT_IMPLEMENTED
 
 /* | 라이브러리 함수... | */
 
@@ -58,12 +80,8 @@ void insertion_sort(T *values, size_t n) {
     // 두 번째 원소부터 선택한다.
     for (int i = 1; i < n; i++) {
         // 선택한 원소의 앞에 있는 모든 원소를 한 칸씩 오른쪽으로 민다.
-        for (int j = i; j > 0 && values[j] < values[j - 1]; j--) {
-            T value = values[j];
-
-            values[j] = values[j - 1];
-            values[j - 1] = value;
-        }
+        for (int j = i; j > 0 && SORT_LESS(values[j], values[j - 1]); j--)
+            SORT_SWAP(values[j], values[j - 1]);
     }
 }
 
@@ -0,0 +1,191 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef MERGE_K_SORTED_H
+#define MERGE_K_SORTED_H
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* | 매크로 정의... | */
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 
+    정렬된 `k`개의 배열 `runs[i]` (크기 `lens[i]`)를 하나로 합쳐서 `out`에 저장한다.
+    (`out`의 크기는 모든 배열의 크기의 합보다 크거나 같아야 한다.)
+*/
+void merge_k_sorted(const T **runs, const size_t *lens, int k, T *out);
+
+#endif // `MERGE_K_SORTED_H`
+
+#ifdef MERGE_K_SORTED_IMPLEMENTATION
+
+/* | 자료형 선언 및 정의... | */
+
+/* 합칠 배열 하나에서 다음에 꺼낼 원소의 위치를 나타내는 구조체. */
+typedef struct MergeKCursor {
+    const T *ptr;   // 다음에 꺼낼 원소.
+    const T *end;   // 배열의 끝.
+} MergeKCursor;
+
+/* 패자 트리의 노드를 나타내는 구조체. */
+typedef struct MergeKNode {
+    T key;          // 이 노드에 저장된 배열의 현재 원소.
+    int run;        // 배열의 번호.
+} MergeKNode;
+
+/* | 라이브러리 함수... | */
+
+/* 
+    노드 `a`의 원소가 노드 `b`의 원소보다 먼저 와야 하는지 확인한다. 
+    값이 같다면 앞쪽 배열의 원소가 먼저 오므로, 정렬의 안정성이 유지된다.
+*/
+static inline bool merge_k_sorted_before(MergeKNode a, MergeKNode b) {
+    if (SORT_LESS(a.key, b.key)) return true;
+    if (SORT_LESS(b.key, a.key)) return false;
+
+    return a.run < b.run;
+}
+
+/* 
+    `tree[t]`를 루트로 하는 부분 트리에서 승자를 구하고, 각 노드에는 
+    패자를 남긴다. (`t >= k`는 `t - k`번째 배열을 나타내는 리프 노드이다.)
+*/
+static MergeKNode merge_k_sorted_build(const MergeKCursor *cursors, MergeKNode *tree, int k, int t) {
+    if (t >= k) return (MergeKNode) { .key = *cursors[t - k].ptr, .run = t - k };
+
+    MergeKNode a = merge_k_sorted_build(cursors, tree, k, 2 * t);
+    MergeKNode b = merge_k_sorted_build(cursors, tree, k, 2 * t + 1);
+
+    if (merge_k_sorted_before(a, b)) {
+        tree[t] = b;
+
+        return a;
+    } else {
+        tree[t] = a;
+
+        return b;
+    }
+}
+
+/* 
+    정렬된 `k`개의 배열 `runs[i]` (크기 `lens[i]`)를 하나로 합쳐서 `out`에 저장한다.
+    (`out`의 크기는 모든 배열의 크기의 합보다 크거나 같아야 한다.)
+*/
+void merge_k_sorted(const T **runs, const size_t *lens, int k, T *out) {
+    if (runs == NULL || lens == NULL || out == NULL || k <= 0) return;
+
+    /*
+        패자 트리 (loser tree)는 `k`개의 배열에서 가장 작은 원소를 찾는 
+        토너먼트 트리로, 각 내부 노드에는 그 노드에서 벌어진 경기의 
+        패자를, 루트의 위에는 최종 승자를 저장한다.
+
+        승자의 원소를 꺼내고 나면, 승자가 있던 리프에서 루트까지 올라가며
+        각 노드에 저장된 패자와 한 번씩만 비교하면 다음 승자를 찾을 수 
+        있다. 따라서 원소 하나를 꺼낼 때마다 `log k`번만 비교하며, 두 
+        자식을 모두 살펴봐야 하는 힙보다 비교 횟수와 분기가 적다.
+
+        각 노드에는 배열의 번호와 함께 현재 원소를 저장하여, 비교할 때 
+        다른 배열의 메모리를 읽지 않도록 한다. 또한, 원소를 모두 꺼낸 
+        배열이 생기면 그 배열을 빼고 트리를 다시 만들기 때문에, 원소를 
+        꺼낼 때마다 배열의 끝에 도달했는지 확인할 필요가 없다.
+    */
+
+    MergeKCursor *cursors = malloc(k * sizeof *cursors);
+    MergeKNode *tree = malloc(k * sizeof *tree);
+
+    if (cursors == NULL || tree == NULL) {
+        free(cursors);
+        free(tree);
+
+        return;
+    }
+
+    int m = 0;
+
+    // 비어 있지 않은 배열만 순서대로 모은다.
+    for (int i = 0; i < k; i++)
+        if (lens[i] > 0)
+            cursors[m++] = (MergeKCursor) { .ptr = runs[i], .end = runs[i] + lens[i] };
+
+    while (m > 1) {
+        // 최종 승자는 `tree[0]`에 저장한다.
+        tree[0] = merge_k_sorted_build(cursors, tree, m, 1);
+
+        for (;;) {
+            MergeKNode node = tree[0];
+
+            *out++ = node.key;
+
+            const T *ptr = ++cursors[node.run].ptr;
+
+            // 원소를 모두 꺼낸 배열은 빼고, 트리를 다시 만든다.
+            if (ptr == cursors[node.run].end) {
+                memmove(cursors + node.run, cursors + node.run + 1, (m - node.run - 1) * sizeof *cursors);
+
+                m--;
+
+                break;
+            }
+
+            node.key = *ptr;
+
+            // 승자가 있던 리프에서 루트까지 올라가며, 각 노드의 패자와 비교한다.
+            for (int t = (node.run + m) / 2; t > 0; t /= 2) {
+                if (merge_k_sorted_before(tree[t], node)) {
+                    MergeKNode temp = tree[t];
+
+                    tree[t] = node;
+                    node = temp;
+                }
+            }
+
+            tree[0] = node;
+        }
+    }
+
+    // 마지막으로 남은 배열은 그대로 복사한다.
+    if (m == 1) memcpy(out, cursors[0].ptr, (cursors[0].end - cursors[0].ptr) * sizeof *out);
+
+    free(cursors);
+    free(tree);
+}
+
+#endif // `MERGE_K_SORTED_IMPLEMENTATION`
\ No newline at end of file
@@ -0,0 +1,277 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef MERGE_SORT_PARALLEL_H
+#define MERGE_SORT_PARALLEL_H
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* | 매크로 정의... | */
+
+/* 스레드 하나가 맡을 부분 배열의 최소 크기. */
+#define MERGE_SORT_PARALLEL_MIN_CHUNK    8192
+
+/* 병렬 병합 정렬에 사용할 스레드의 최대 개수. */
+#define MERGE_SORT_PARALLEL_MAX_THREADS  256
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 여러 개의 스레드를 이용하여, 주어진 배열을 병합 정렬한다. */
+void merge_sort_parallel(T *values, size_t n, int threads);
+
+#endif // `MERGE_SORT_PARALLEL_H`
+
+#ifdef MERGE_SORT_PARALLEL_IMPLEMENTATION
+
+#ifndef MERGE_SORT_IMPLEMENTATION
+#define MERGE_SORT_IMPLEMENTATION
+#endif
+
+#include "merge-sort.h"
+
+/* | 자료형 선언 및 정의... | */
+
+/* 스레드 하나가 맡을 작업을 나타내는 구조체. */
+typedef struct MergeSortTask {
+    const T *src;          // 합칠 부분 배열들이 저장된 배열.
+    T *dst;                // 합친 결과를 저장할 배열.
+    T *aux;                // 정렬에 사용할 임시 메모리 공간.
+    const size_t *bounds;  // 각 부분 배열의 시작 위치. (`bounds[runs]`는 배열의 크기)
+    int runs;              // 부분 배열의 개수.
+    size_t low;            // 이 작업이 맡은 구간의 시작 위치.
+    size_t high;           // 이 작업이 맡은 구간의 끝 위치. (포함하지 않음)
+} MergeSortTask;
+
+/* | 라이브러리 함수... | */
+
+/* 
+    정렬된 두 배열 `a`와 `b`를 안정적으로 합쳤을 때, 처음 `k`개의 원소 중에서
+    `a`에서 온 원소의 개수를 이진 탐색으로 구한다. (co-ranking)
+*/
+static size_t merge_sort_parallel_co_rank(size_t k, const T *a, size_t m, const T *b, size_t l) {
+    size_t low = (k > l) ? k - l : 0, high = (k < m) ? k : m;
+
+    while (low < high) {
+        size_t i = low + (high - low) / 2, j = k - i;
+
+        // `a[i]`가 `b[j - 1]`보다 먼저 와야 한다면, `a`에서 더 많은 원소를 가져와야 한다.
+        if (j > 0 && i < m && !SORT_LESS(b[j - 1], a[i])) low = i + 1;
+        else high = i;
+    }
+
+    return low;
+}
+
+/* 주어진 구간의 부분 배열을 정렬한다. */
+static void *merge_sort_parallel_sort_worker(void *arg) {
+    MergeSortTask *task = arg;
+
+    merge_sort_bottom_up(task->dst + task->low, task->high - task->low, task->aux + task->low);
+
+    return NULL;
+}
+
+/* 인접한 부분 배열끼리 합친 결과 중에서, 주어진 구간에 해당하는 부분만 계산한다. */
+static void *merge_sort_parallel_merge_worker(void *arg) {
+    MergeSortTask *task = arg;
+
+    for (int r = 0; r < task->runs; r += 2) {
+        size_t low = task->bounds[r], mid = task->bounds[r + 1];
+        size_t high = (r + 1 < task->runs) ? task->bounds[r + 2] : mid;
+
+        // 두 부분 배열을 합친 결과 중에서, 이 작업이 맡은 구간과 겹치는 부분을 구한다.
+        size_t k0 = (low > task->low) ? low : task->low;
+        size_t k1 = (high < task->high) ? high : task->high;
+
+        if (k0 >= k1) continue;
+
+        const T *a = task->src + low, *b = task->src + mid;
+
+        size_t m = mid - low, l = high - mid;
+
+        size_t i = merge_sort_parallel_co_rank(k0 - low, a, m, b, l), j = (k0 - low) - i;
+        size_t i1 = merge_sort_parallel_co_rank(k1 - low, a, m, b, l), j1 = (k1 - low) - i1;
+
+        T *dst = task->dst + k0;
+
+        // 두 부분 배열에서 가져온 원소들을 하나로 합친다.
+        while (i < i1 && j < j1)
+            *dst++ = SORT_LESS(b[j], a[i]) ? b[j++] : a[i++];
+
+        memcpy(dst, a + i, (i1 - i) * sizeof *dst);
+        memcpy(dst + (i1 - i), b + j, (j1 - j) * sizeof *dst);
+    }
+
+    return NULL;
+}
+
+/* 주어진 작업들을 여러 개의 스레드에서 동시에 실행한다. */
+static void merge_sort_parallel_run(void *(*func)(void *), MergeSortTask *tasks, int count) {
+    pthread_t handles[MERGE_SORT_PARALLEL_MAX_THREADS];
+
+    int created[MERGE_SORT_PARALLEL_MAX_THREADS] = { 0 };
+
+    // 첫 번째 작업은 현재 스레드에서 실행한다.
+    for (int t = 1; t < count; t++)
+        created[t] = (pthread_create(&handles[t], NULL, func, &tasks[t]) == 0);
+
+    func(&tasks[0]);
+
+    for (int t = 1; t < count; t++) {
+        // 스레드를 생성하지 못한 작업은 현재 스레드에서 실행한다.
+        if (created[t]) pthread_join(handles[t], NULL);
+        else func(&tasks[t]);
+    }
+}
+
+/* 여러 개의 스레드를 이용하여, 주어진 배열을 병합 정렬한다. */
+void merge_sort_parallel(T *values, size_t n, int threads) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        먼저 배열을 스레드의 개수만큼 나누어 각 스레드에서 동시에 
+        정렬한 다음, 인접한 부분 배열끼리 합치는 과정을 반복한다.
+
+        부분 배열을 합칠 때도 모든 스레드를 사용하기 위해, 합친 결과를
+        스레드의 개수만큼 같은 크기의 구간으로 나누고, 각 구간의 시작
+        위치에 들어갈 원소가 두 부분 배열의 어디에서 오는지를 이진 
+        탐색으로 찾는다. (co-ranking) 이렇게 하면 마지막 단계에서 
+        두 개의 큰 부분 배열을 합칠 때도 모든 스레드가 같은 양의 일을
+        하게 되며, 같은 값을 가진 원소의 순서도 그대로 유지된다.
+    */
+
+    // 스레드의 개수가 1 이하이면, 스레드를 사용하지 않는다.
+    if (threads <= 1) {
+        merge_sort_bottom_up(values, n, NULL);
+
+        return;
+    }
+
+    // 스레드의 개수가 양수일 때만 `size_t`로 변환하여 비교해야, 음수가 큰 값으로 바뀌지 않는다.
+    if ((size_t) threads > n / MERGE_SORT_PARALLEL_MIN_CHUNK) 
+        threads = (int) (n / MERGE_SORT_PARALLEL_MIN_CHUNK);
+
+    if (threads > MERGE_SORT_PARALLEL_MAX_THREADS) 
+        threads = MERGE_SORT_PARALLEL_MAX_THREADS;
+
+    // 배열의 크기가 작으면, 스레드를 사용하지 않는다.
+    if (threads <= 1) {
+        merge_sort_bottom_up(values, n, NULL);
+
+        return;
+    }
+
+    // 병합 정렬에 필요한 임시 메모리 공간을 할당한다.
+    T *aux = malloc(n * sizeof *aux);
+
+    // 메모리 공간을 할당할 수 없다면, 스레드를 사용하지 않고 정렬한다.
+    if (aux == NULL) {
+        merge_sort_bottom_up(values, n, NULL);
+
+        return;
+    }
+
+    MergeSortTask tasks[MERGE_SORT_PARALLEL_MAX_THREADS];
+
+    size_t bounds[MERGE_SORT_PARALLEL_MAX_THREADS + 1];
+
+    for (int t = 0; t <= threads; t++)
+        bounds[t] = (size_t) t * n / threads;
+
+    for (int t = 0; t < threads; t++)
+        tasks[t] = (MergeSortTask) { 
+            .dst = values, 
+            .aux = aux, 
+            .low = bounds[t], 
+            .high = bounds[t + 1] 
+        };
+
+    // 각 스레드에서 부분 배열을 정렬한다.
+    merge_sort_parallel_run(merge_sort_parallel_sort_worker, tasks, threads);
+
+    const T *src = values;
+
+    T *dst = aux;
+
+    int runs = threads;
+
+    // 부분 배열이 하나만 남을 때까지, 인접한 부분 배열끼리 합친다.
+    while (runs > 1) {
+        for (int t = 0; t < threads; t++) {
+            tasks[t].src = src;
+            tasks[t].dst = dst;
+            tasks[t].bounds = bounds;
+            tasks[t].runs = runs;
+        }
+
+        merge_sort_parallel_run(merge_sort_parallel_merge_worker, tasks, threads);
+
+        // 합쳐진 부분 배열들의 시작 위치를 다시 계산한다.
+        for (int r = 0; 2 * r < runs; r++)
+            bounds[r] = bounds[2 * r];
+
+        runs = (runs + 1) / 2;
+
+        bounds[runs] = n;
+
+        // 원래 배열과 임시 메모리 공간의 역할을 서로 바꾼다.
+        T *temp = (T *) src;
+
+        src = dst;
+        dst = temp;
+    }
+
+    // 정렬된 결과가 임시 메모리 공간에 있다면, 원래 배열로 옮긴다.
+    if (src != values) {
+        for (int t = 0; t < threads; t++) {
+            tasks[t].src = src;
+            tasks[t].dst = values;
+            tasks[t].bounds = bounds;
+            tasks[t].runs = 1;
+        }
+
+        merge_sort_parallel_run(merge_sort_parallel_merge_worker, tasks, threads);
+    }
+
+    // 임시 메모리 공간을 해제한다.
+    free(aux);
+}
+
+#endif // `MERGE_SORT_PARALLEL_IMPLEMENTATION`
\ No newline at end of file
@@ -25,6 +25,46 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+#include "sorting-network.h"
+
+/* | 매크로 정의... | */
+
+/* 정렬 네트워크를 사용할 부분 배열의 최대 크기. */
+#define MERGE_SORT_NETWORK_THRESHOLD  32
+
+/* 병합하기 전에 삽입 정렬로 먼저 정렬할 부분 배열의 크기. */
+#define MERGE_SORT_RUN_SIZE  32
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+#if defined(SORT_LESS_DEFAULT) && !defined(MERGE_SORT_NETWORK)
+
+/* 
+    크기가 작은 부분 배열을 정렬 네트워크로 정렬할지 여부. 
+
+    `SORT_LESS`를 직접 정의하더라도, 같은 값을 가진 원소끼리 서로 구별할 
+    수 없다면 이 매크로를 정의하여 정렬 네트워크를 사용할 수 있다.
+*/
+#define MERGE_SORT_NETWORK
+
+#endif
+
+#ifndef SORT_SWAP
+
+/* 두 원소의 위치를 맞바꾼다. */
+#define SORT_SWAP(a, b)  do { T _value = (a); (a) = (b); (b) = _value; } while (0)
+
+#endif
 
 /* | 자료형 선언 및 정의... | */
 
@@ -36,9 +76,21 @@ typedef int T;
 /* 주어진 배열을 병합 정렬한다. */
 void merge_sort(T *values, size_t n);
 
+/* 주어진 배열을 상향식 (bottom-up)으로 병합 정렬한다. */
+void merge_sort_bottom_up(T *values, size_t n, T *aux);
+
 #endif // `MERGE_SORT_H`
 
-#ifdef MERGE_SORT_IMPLEMENTATION
+#if defined(MERGE_SORT_IMPLEMENTATION) && !defined(MERGE_SORT_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define MERGE_SORT_IMPLEMENTED
+
+#ifndef SORTING_NETWORK_IMPLEMENTATION
+#define SORTING_NETWORK_IMPLEMENTATION
+#endif
+
+#include "sorting-network.h"
 
 /* | 라이브러리 함수... | */
 
@@ -46,6 +98,19 @@ void merge_sort(T *values, size_t n);
 static void merge_sort_helper(T *values, T *aux, int low, int high) {
     if (values == NULL || aux == NULL || low >= high) return;
 
+#ifdef MERGE_SORT_NETWORK
+    /* 
+        크기가 작은 부분 배열은 정렬 네트워크로 정렬한다. 정렬 네트워크는
+        안정 정렬이 아니지만, 같은 값을 가진 원소끼리 서로 구별할 수 
+        없다면 상관없다.
+    */
+    if (high - low + 1 <= MERGE_SORT_NETWORK_THRESHOLD) {
+        sorting_network_sort(values + low, high - low + 1);
+
+        return;
+    }
+#endif
+
     // 배열을 반으로 나눈다.
     int mid = (low + high) / 2;
 
@@ -71,7 +136,7 @@ static void merge_sort_helper(T *values, T *aux, int low, int high) {
 
         if (i > mid) values[k] = aux[j++];
         else if (j > high) values[k] = aux[i++];
-        else if (aux[j] < aux[i]) values[k] = aux[j++];
+        else if (SORT_LESS(aux[j], aux[i])) values[k] = aux[j++];
         else values[k] = aux[i++];
     }
 }
@@ -103,4 +168,94 @@ void merge_sort(T *values, size_t n) {
     free(aux);
 }
 
+/* 주어진 부분 배열 `[low, high)`를 삽입 정렬한다. */
+static void merge_sort_insertion(T *values, size_t low, size_t high) {
+    for (size_t i = low + 1; i < high; i++) {
+        T value = values[i];
+
+        size_t j = i;
+
+        // 선택한 원소보다 큰 원소들을 한 칸씩 오른쪽으로 민다.
+        for (; j > low && SORT_LESS(value, values[j - 1]); j--)
+            values[j] = values[j - 1];
+
+        values[j] = value;
+    }
+}
+
+/* 정렬된 두 부분 배열 `src[low, mid)`와 `src[mid, high)`를 합쳐 `dst[low, high)`에 저장한다. */
+static void merge_sort_merge(const T *src, T *dst, size_t low, size_t mid, size_t high) {
+    // 두 부분 배열이 이미 순서대로 놓여 있다면, 합칠 필요 없이 복사만 한다.
+    if (mid >= high || !SORT_LESS(src[mid], src[mid - 1])) {
+        memcpy(dst + low, src + low, (high - low) * sizeof *dst);
+
+        return;
+    }
+
+    size_t i = low, j = mid, k = low;
+
+    while (i < mid && j < high)
+        dst[k++] = SORT_LESS(src[j], src[i]) ? src[j++] : src[i++];
+
+    // 한쪽 부분 배열이 비면, 나머지 부분 배열의 원소들을 그대로 복사한다.
+    if (i < mid) memcpy(dst + k, src + i, (mid - i) * sizeof *dst);
+    else memcpy(dst + k, src + j, (high - j) * sizeof *dst);
+}
+
+/* 주어진 배열을 상향식 (bottom-up)으로 병합 정렬한다. */
+void merge_sort_bottom_up(T *values, size_t n, T *aux) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        상향식 병합 정렬은 순환 호출 대신 반복문을 이용하여, 크기가 
+        작은 부분 배열부터 차례대로 합쳐 나가는 방식으로 동작한다.
+
+        여기서는 먼저 `MERGE_SORT_RUN_SIZE`개의 원소로 이루어진 부분
+        배열들을 삽입 정렬하고, 매 단계마다 원래 배열과 임시 메모리 
+        공간의 역할을 서로 바꿔가며 (ping-pong) 합치기 때문에, 
+        합치기 전에 부분 배열을 복사하는 과정이 필요하지 않다.
+
+        임시 메모리 공간 `aux`에는 `n`개 이상의 원소가 들어갈 수 있어야
+        하며, `NULL`을 넘겨주면 직접 메모리 공간을 할당하여 사용한다.
+        같은 크기의 배열을 여러 번 정렬할 때는 임시 메모리 공간을 
+        재사용하면 메모리 할당 비용을 아낄 수 있다.
+    */
+
+    T *buffer = aux;
+
+    if (buffer == NULL) {
+        // 병합 정렬에 필요한 임시 메모리 공간을 할당한다.
+        buffer = malloc(n * sizeof *buffer);
+
+        if (buffer == NULL) return;
+    }
+
+    // 작은 부분 배열들을 삽입 정렬한다.
+    for (size_t low = 0; low < n; low += MERGE_SORT_RUN_SIZE)
+        merge_sort_insertion(values, low, (n - low < MERGE_SORT_RUN_SIZE) ? n : low + MERGE_SORT_RUN_SIZE);
+
+    T *src = values, *dst = buffer;
+
+    for (size_t width = MERGE_SORT_RUN_SIZE; width < n; width *= 2) {
+        for (size_t low = 0; low < n; low += 2 * width) {
+            size_t mid = (n - low < width) ? n : low + width;
+            size_t high = (n - mid < width) ? n : mid + width;
+
+            merge_sort_merge(src, dst, low, mid, high);
+        }
+
+        // 원래 배열과 임시 메모리 공간의 역할을 서로 바꾼다.
+        T *temp = src;
+
+        src = dst;
+        dst = temp;
+    }
+
+    // 정렬된 결과가 임시 메모리 공간에 있다면, 원래 배열로 옮긴다.
+    if (src != values) memcpy(values, src, n * sizeof *values);
+
+    // 직접 할당한 임시 메모리 공간을 해제한다.
+    if (aux == NULL) free(buffer);
+}
+
 #endif // `MERGE_SORT_IMPLEMENTATION`
\ No newline at end of file
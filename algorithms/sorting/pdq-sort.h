@@ -0,0 +1,501 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef PDQ_SORT_H
+#define PDQ_SORT_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "heap-sort.h"
+
+/* | 매크로 정의... | */
+
+/* 삽입 정렬을 사용할 부분 배열의 최대 크기. */
+#define PDQ_SORT_INSERTION_THRESHOLD       24
+
+/* 9개의 원소로 기준 항목을 선택 (ninther)할 부분 배열의 최소 크기. */
+#define PDQ_SORT_NINTHER_THRESHOLD         128
+
+/* 부분 삽입 정렬에서 허용하는 원소의 최대 이동 횟수. */
+#define PDQ_SORT_PARTIAL_INSERTION_LIMIT   8
+
+/* 분기 없는 분할에서 한 번에 살펴볼 원소의 개수. */
+#define PDQ_SORT_BLOCK_SIZE                64
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+#ifndef SORT_SWAP
+
+/* 두 원소의 위치를 맞바꾼다. */
+#define SORT_SWAP(a, b)  do { T _value = (a); (a) = (b); (b) = _value; } while (0)
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 배열을 패턴 무력화 퀵 정렬 (pattern-defeating quicksort)한다. */
+void pdq_sort(T *values, size_t n);
+
+#endif // `PDQ_SORT_H`
+
+#if defined(PDQ_SORT_IMPLEMENTATION) && !defined(PDQ_SORT_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define PDQ_SORT_IMPLEMENTED
+
+#ifndef HEAP_SORT_IMPLEMENTATION
+#define HEAP_SORT_IMPLEMENTATION
+#endif
+
+#include "heap-sort.h"
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 부분 배열 `[begin, end)`를 삽입 정렬한다. */
+static void pdq_sort_insertion(T *begin, T *end) {
+    if (begin == end) return;
+
+    for (T *cur = begin + 1; cur != end; cur++) {
+        T *sift = cur, *sift_1 = cur - 1;
+
+        if (SORT_LESS(*sift, *sift_1)) {
+            T value = *sift;
+
+            do {
+                *sift-- = *sift_1;
+            } while (sift != begin && SORT_LESS(value, *--sift_1));
+
+            *sift = value;
+        }
+    }
+}
+
+/* 
+    주어진 부분 배열 `[begin, end)`를 삽입 정렬한다. 
+
+    `begin[-1]`이 부분 배열의 모든 원소보다 작거나 같아야 한다.
+*/
+static void pdq_sort_unguarded_insertion(T *begin, T *end) {
+    if (begin == end) return;
+
+    for (T *cur = begin + 1; cur != end; cur++) {
+        T *sift = cur, *sift_1 = cur - 1;
+
+        if (SORT_LESS(*sift, *sift_1)) {
+            T value = *sift;
+
+            do {
+                *sift-- = *sift_1;
+            } while (SORT_LESS(value, *--sift_1));
+
+            *sift = value;
+        }
+    }
+}
+
+/* 
+    주어진 부분 배열 `[begin, end)`를 삽입 정렬하되, 원소를 너무 많이
+    이동해야 하면 정렬을 중단한다. 정렬을 마쳤을 경우에만 1을 반환한다.
+*/
+static int pdq_sort_partial_insertion(T *begin, T *end) {
+    if (begin == end) return 1;
+
+    size_t limit = 0;
+
+    for (T *cur = begin + 1; cur != end; cur++) {
+        T *sift = cur, *sift_1 = cur - 1;
+
+        if (SORT_LESS(*sift, *sift_1)) {
+            T value = *sift;
+
+            do {
+                *sift-- = *sift_1;
+            } while (sift != begin && SORT_LESS(value, *--sift_1));
+
+            *sift = value;
+
+            limit += cur - sift;
+        }
+
+        if (limit > PDQ_SORT_PARTIAL_INSERTION_LIMIT) return 0;
+    }
+
+    return 1;
+}
+
+/* 두 원소를 정렬한다. */
+static void pdq_sort_sort2(T *a, T *b) {
+    if (SORT_LESS(*b, *a)) SORT_SWAP(*a, *b);
+}
+
+/* 세 원소를 정렬하여, 중앙값이 `b`의 위치에 오도록 한다. */
+static void pdq_sort_sort3(T *a, T *b, T *c) {
+    pdq_sort_sort2(a, b);
+    pdq_sort_sort2(b, c);
+    pdq_sort_sort2(a, b);
+}
+
+/* 
+    분할 과정에서 자리를 잘못 잡은 원소들을 서로 맞바꾼다.
+
+    두 블록에서 찾은 원소의 개수가 서로 다르면, 교환 대신 순환 이동을
+    이용하여 원소를 옮기는 횟수를 줄인다.
+*/
+static void pdq_sort_swap_offsets(
+    T *first, 
+    T *last, 
+    const unsigned char *offsets_l, 
+    const unsigned char *offsets_r, 
+    size_t num, 
+    int use_swaps
+) {
+    if (use_swaps) {
+        for (size_t i = 0; i < num; i++)
+            SORT_SWAP(first[offsets_l[i]], *(last - offsets_r[i]));
+    } else if (num > 0) {
+        T *l = first + offsets_l[0], *r = last - offsets_r[0];
+
+        T value = *l;
+
+        *l = *r;
+
+        for (size_t i = 1; i < num; i++) {
+            l = first + offsets_l[i];
+            *r = *l;
+
+            r = last - offsets_r[i];
+            *l = *r;
+        }
+
+        *r = value;
+    }
+}
+
+/* 
+    기준 항목 `*begin`보다 작은 원소를 왼쪽으로, 크거나 같은 원소를
+    오른쪽으로 옮기고, 기준 항목의 최종 위치를 반환한다. 
+
+    원소를 `PDQ_SORT_BLOCK_SIZE`개씩 살펴보면서 교환할 원소의 위치를 
+    조건 분기 없이 기록하기 때문에, 분기 예측 실패가 거의 일어나지 않는다.
+    (BlockQuicksort)
+*/
+static T *pdq_sort_partition_right(T *begin, T *end, int *already_partitioned) {
+    T pivot = *begin;
+
+    T *first = begin, *last = end;
+
+    // 기준 항목보다 크거나 같은 첫 번째 원소를 찾는다.
+    while (SORT_LESS(*++first, pivot)) ;
+
+    // 기준 항목보다 작은 마지막 원소를 찾는다.
+    if (first - 1 == begin) 
+        while (first < last && !SORT_LESS(*--last, pivot)) ;
+    else 
+        while (!SORT_LESS(*--last, pivot)) ;
+
+    // 교환할 원소가 없다면, 이미 분할되어 있는 배열이다.
+    *already_partitioned = (first >= last);
+
+    if (!*already_partitioned) {
+        SORT_SWAP(*first, *last);
+
+        first++;
+
+        unsigned char offsets_l[PDQ_SORT_BLOCK_SIZE];
+        unsigned char offsets_r[PDQ_SORT_BLOCK_SIZE];
+
+        T *offsets_l_base = first, *offsets_r_base = last;
+
+        size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+
+        while (first < last) {
+            size_t num_unknown = last - first;
+
+            // 남은 원소의 개수가 블록 크기보다 작으면, 남은 원소를 양쪽에 나눠준다.
+            size_t left_split = (num_l == 0) ? ((num_r == 0) ? num_unknown / 2 : num_unknown) : 0;
+            size_t right_split = (num_r == 0) ? (num_unknown - left_split) : 0;
+
+            // 왼쪽 블록에서 기준 항목보다 크거나 같은 원소의 위치를 기록한다.
+            if (left_split >= PDQ_SORT_BLOCK_SIZE) {
+                for (size_t i = 0; i < PDQ_SORT_BLOCK_SIZE;) {
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                }
+            } else {
+                for (size_t i = 0; i < left_split;) {
+                    offsets_l[num_l] = i++; num_l += !SORT_LESS(*first, pivot); first++;
+                }
+            }
+
+            // 오른쪽 블록에서 기준 항목보다 작은 원소의 위치를 기록한다.
+            if (right_split >= PDQ_SORT_BLOCK_SIZE) {
+                for (size_t i = 0; i < PDQ_SORT_BLOCK_SIZE;) {
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                }
+            } else {
+                for (size_t i = 0; i < right_split;) {
+                    offsets_r[num_r] = ++i; num_r += SORT_LESS(*--last, pivot);
+                }
+            }
+
+            // 기록한 위치의 원소들을 서로 맞바꾼다.
+            size_t num = (num_l < num_r) ? num_l : num_r;
+
+            pdq_sort_swap_offsets(
+                offsets_l_base, 
+                offsets_r_base, 
+                offsets_l + start_l, 
+                offsets_r + start_r, 
+                num, 
+                num_l == num_r
+            );
+
+            num_l -= num, num_r -= num;
+            start_l += num, start_r += num;
+
+            if (num_l == 0) {
+                start_l = 0;
+                offsets_l_base = first;
+            }
+
+            if (num_r == 0) {
+                start_r = 0;
+                offsets_r_base = last;
+            }
+        }
+
+        // 한쪽 블록에 남아 있는 원소들을 마저 옮긴다.
+        if (num_l > 0) {
+            const unsigned char *offsets = offsets_l + start_l;
+
+            while (num_l--) {
+                last--;
+
+                SORT_SWAP(offsets_l_base[offsets[num_l]], *last);
+            }
+
+            first = last;
+        }
+
+        if (num_r > 0) {
+            const unsigned char *offsets = offsets_r + start_r;
+
+            while (num_r--) {
+                SORT_SWAP(*(offsets_r_base - offsets[num_r]), *first);
+
+                first++;
+            }
+
+            last = first;
+        }
+    }
+
+    // 기준 항목을 최종 위치로 옮긴다.
+    T *pivot_pos = first - 1;
+
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+
+    return pivot_pos;
+}
+
+/* 
+    기준 항목 `*begin`보다 작거나 같은 원소를 왼쪽으로, 큰 원소를
+    오른쪽으로 옮기고, 기준 항목의 최종 위치를 반환한다.
+
+    기준 항목과 같은 원소가 많을 때 사용하며, 기준 항목과 같은 원소는
+    모두 왼쪽 부분 배열에 모이므로 다시 정렬할 필요가 없다.
+*/
+static T *pdq_sort_partition_left(T *begin, T *end) {
+    T pivot = *begin;
+
+    T *first = begin, *last = end;
+
+    while (SORT_LESS(pivot, *--last)) ;
+
+    if (last + 1 == end) 
+        while (first < last && !SORT_LESS(pivot, *++first)) ;
+    else 
+        while (!SORT_LESS(pivot, *++first)) ;
+
+    while (first < last) {
+        SORT_SWAP(*first, *last);
+
+        while (SORT_LESS(pivot, *--last)) ;
+        while (!SORT_LESS(pivot, *++first)) ;
+    }
+
+    T *pivot_pos = last;
+
+    *begin = *pivot_pos;
+    *pivot_pos = pivot;
+
+    return pivot_pos;
+}
+
+/* (주어진 배열을 패턴 무력화 퀵 정렬한다.) */
+static void pdq_sort_loop(T *begin, T *end, int bad_allowed, int leftmost) {
+    for (;;) {
+        size_t size = end - begin;
+
+        // 크기가 작은 부분 배열은 삽입 정렬로 마무리한다.
+        if (size < PDQ_SORT_INSERTION_THRESHOLD) {
+            if (leftmost) pdq_sort_insertion(begin, end);
+            else pdq_sort_unguarded_insertion(begin, end);
+
+            return;
+        }
+
+        // 세 값 또는 아홉 값의 중앙값을 기준 항목으로 선택하여 맨 앞으로 옮긴다.
+        size_t s2 = size / 2;
+
+        if (size > PDQ_SORT_NINTHER_THRESHOLD) {
+            pdq_sort_sort3(begin, begin + s2, end - 1);
+            pdq_sort_sort3(begin + 1, begin + (s2 - 1), end - 2);
+            pdq_sort_sort3(begin + 2, begin + (s2 + 1), end - 3);
+            pdq_sort_sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1));
+
+            SORT_SWAP(*begin, *(begin + s2));
+        } else {
+            pdq_sort_sort3(begin + s2, begin, end - 1);
+        }
+
+        /*
+            바로 앞의 원소 (이전 분할의 기준 항목)가 현재 기준 항목과 같다면,
+            기준 항목과 같은 원소들을 왼쪽으로 모으고 오른쪽만 계속 정렬한다.
+            이렇게 하면 중복된 원소가 많은 배열도 선형 시간에 가깝게 정렬된다.
+        */
+        if (!leftmost && !SORT_LESS(*(begin - 1), *begin)) {
+            begin = pdq_sort_partition_left(begin, end) + 1;
+
+            continue;
+        }
+
+        int already_partitioned = 0;
+
+        T *pivot_pos = pdq_sort_partition_right(begin, end, &already_partitioned);
+
+        size_t l_size = pivot_pos - begin;
+        size_t r_size = end - (pivot_pos + 1);
+
+        if (l_size < size / 8 || r_size < size / 8) {
+            // 분할이 너무 자주 한쪽으로 치우치면, 힙 정렬로 전환한다.
+            if (--bad_allowed == 0) {
+                heap_sort(begin, end - begin);
+
+                return;
+            }
+
+            // 일부 원소의 위치를 바꿔서, 분할을 치우치게 만드는 패턴을 깨뜨린다.
+            if (l_size >= PDQ_SORT_INSERTION_THRESHOLD) {
+                SORT_SWAP(*begin, *(begin + l_size / 4));
+                SORT_SWAP(*(pivot_pos - 1), *(pivot_pos - l_size / 4));
+
+                if (l_size > PDQ_SORT_NINTHER_THRESHOLD) {
+                    SORT_SWAP(*(begin + 1), *(begin + (l_size / 4 + 1)));
+                    SORT_SWAP(*(begin + 2), *(begin + (l_size / 4 + 2)));
+                    SORT_SWAP(*(pivot_pos - 2), *(pivot_pos - (l_size / 4 + 1)));
+                    SORT_SWAP(*(pivot_pos - 3), *(pivot_pos - (l_size / 4 + 2)));
+                }
+            }
+
+            if (r_size >= PDQ_SORT_INSERTION_THRESHOLD) {
+                SORT_SWAP(*(pivot_pos + 1), *(pivot_pos + (1 + r_size / 4)));
+                SORT_SWAP(*(end - 1), *(end - r_size / 4));
+
+                if (r_size > PDQ_SORT_NINTHER_THRESHOLD) {
+                    SORT_SWAP(*(pivot_pos + 2), *(pivot_pos + (2 + r_size / 4)));
+                    SORT_SWAP(*(pivot_pos + 3), *(pivot_pos + (3 + r_size / 4)));
+                    SORT_SWAP(*(end - 2), *(end - (1 + r_size / 4)));
+                    SORT_SWAP(*(end - 3), *(end - (2 + r_size / 4)));
+                }
+            }
+        } else {
+            // 이미 분할되어 있던 배열은 정렬되어 있을 가능성이 높으므로, 부분 삽입 정렬을 시도해본다.
+            if (already_partitioned 
+                && pdq_sort_partial_insertion(begin, pivot_pos) 
+                && pdq_sort_partial_insertion(pivot_pos + 1, end)) return;
+        }
+
+        // 왼쪽 부분 배열은 순환 호출로, 오른쪽 부분 배열은 반복문으로 정렬한다.
+        pdq_sort_loop(begin, pivot_pos, bad_allowed, leftmost);
+
+        begin = pivot_pos + 1;
+        leftmost = 0;
+    }
+}
+
+/* 주어진 배열을 패턴 무력화 퀵 정렬 (pattern-defeating quicksort)한다. */
+void pdq_sort(T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        패턴 무력화 퀵 정렬은 인트로 정렬을 개선한 알고리즘으로, 
+        다음과 같은 특징을 가지고 있다.
+
+        1. 분할 과정에서 원소를 블록 단위로 살펴보면서 교환할 원소의
+           위치를 조건 분기 없이 기록하기 때문에, 무작위로 섞인 배열에서도
+           분기 예측 실패가 거의 일어나지 않는다.
+        2. 이미 분할되어 있는 부분 배열은 정렬되어 있을 가능성이 높으므로,
+           부분 삽입 정렬을 시도하여 정렬된 배열을 `O(n)`에 처리한다.
+        3. 분할이 한쪽으로 치우치면 일부 원소를 맞바꿔 입력 배열의 패턴을
+           깨뜨리고, 이런 일이 `log n`번 일어나면 힙 정렬로 전환하여 
+           최악의 경우에도 `O(n * log n)`의 시간 복잡도를 보장한다.
+    */
+
+    int bad_allowed = 0;
+
+    for (size_t m = n; m > 1; m >>= 1)
+        bad_allowed++;
+
+    pdq_sort_loop(values, values + n, bad_allowed, 1);
+}
+
+#endif // `PDQ_SORT_IMPLEMENTATION`
\ No newline at end of file
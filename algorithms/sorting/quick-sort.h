@@ -25,7 +25,44 @@
 
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
+
+#include "heap-sort.h"
+#include "sorting-network.h"
+
+/* | 매크로 정의... | */
+
+/* 정렬 네트워크를 사용할 부분 배열의 최대 크기. */
+#define QUICK_SORT_NETWORK_THRESHOLD    32
+
+/* 9개의 원소로 기준 항목을 선택 (ninther)할 부분 배열의 최소 크기. */
+#define QUICK_SORT_NINTHER_THRESHOLD    128
+
+/* 
+    같은 값이 많은 부분 배열에 3-way 분할 (Bentley-McIlroy)을 사용할지 여부. 
+
+    기준 항목과 같은 값을 가진 원소들을 한가운데로 모아서, 다음 순환 호출에서 
+    제외한다. 서로 다른 값이 적은 배열을 선형 시간에 정렬할 수 있게 된다.
+*/
+#ifndef QUICK_SORT_THREE_WAY
+#define QUICK_SORT_THREE_WAY            1
+#endif
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+#ifndef SORT_SWAP
+
+/* 두 원소의 위치를 맞바꾼다. */
+#define SORT_SWAP(a, b)  do { T _value = (a); (a) = (b); (b) = _value; } while (0)
+
+#endif
 
 /* | 자료형 선언 및 정의... | */
 
@@ -37,83 +74,313 @@ typedef int T;
 /* 주어진 배열을 퀵 정렬한다. */
 void quick_sort(T *values, size_t n);
 
+/* 
+    주어진 배열에서 `k`번째로 작은 원소 (0부터 시작)를 찾아 `values[k]`에 놓는다. 
+    `values[k]`의 앞에는 그보다 작거나 같은 원소만, 뒤에는 크거나 같은 원소만 남는다.
+*/
+void quick_select(T *values, size_t n, size_t k);
+
+/* 주어진 배열에서 가장 작은 `k`개의 원소를 찾아, 배열의 앞쪽에 정렬된 순서로 놓는다. */
+void partial_sort(T *values, size_t n, size_t k);
+
 #endif // `QUICK_SORT_H`
 
 #ifdef QUICK_SORT_IMPLEMENTATION
 
-/* | 전역 변수 정의... | */
+#ifndef SORTING_NETWORK_IMPLEMENTATION
+#define SORTING_NETWORK_IMPLEMENTATION
+#endif
 
-static int initialized = 0;
+#include "sorting-network.h"
 
-/* | 라이브러리 함수... | */
+#ifndef HEAP_SORT_IMPLEMENTATION
+#define HEAP_SORT_IMPLEMENTATION
+#endif
 
-/* 주어진 배열의 모든 원소를 무작위로 섞는다. */
-static void fisher_yates_shuffle(T *values, size_t n) {
-    if (values == NULL || n <= 1) return;
+#include "heap-sort.h"
 
-    if (!initialized) srand((unsigned int) time(NULL));
+/* | 라이브러리 함수... | */
 
-    for (int i = n - 1; i >= 1; i--) {
-        int j = rand() % n;
+/* 세 원소를 정렬하여, 중앙값이 `j`번째 위치에 오도록 한다. */
+static void quick_sort_sort3(T *values, int i, int j, int k) {
+    if (SORT_LESS(values[j], values[i])) SORT_SWAP(values[i], values[j]);
+    if (SORT_LESS(values[k], values[j])) SORT_SWAP(values[j], values[k]);
+    if (SORT_LESS(values[j], values[i])) SORT_SWAP(values[i], values[j]);
+}
 
-        T value = values[i];
+/* 주어진 부분 배열에서 기준이 될 항목을 선택하여, 부분 배열의 맨 앞으로 옮긴다. */
+static void quick_sort_select_pivot(T *values, int low, int high) {
+    int n = high - low + 1, mid = low + n / 2;
 
-        values[i] = values[j];
-        values[j] = value;
+    if (n > QUICK_SORT_NINTHER_THRESHOLD) {
+        int s = n / 8;
+
+        // 세 개의 중앙값의 중앙값 (Tukey's ninther)을 구한다.
+        quick_sort_sort3(values, low, low + s, low + 2 * s);
+        quick_sort_sort3(values, mid - s, mid, mid + s);
+        quick_sort_sort3(values, high - 2 * s, high - s, high);
+        quick_sort_sort3(values, low + s, mid, high - s);
+    } else {
+        quick_sort_sort3(values, low, mid, high);
     }
+
+    SORT_SWAP(values[low], values[mid]);
 }
 
-/* 주어진 배열에서 임의의 항목을 선택하고, 이 배열을 적절하게 분할한다.*/
+/* 주어진 배열을 맨 앞의 원소 (기준 항목)를 중심으로 적절하게 분할한다. */
 static int quick_sort_partition(T *values, int low, int high) {
     if (values == NULL || low >= high) return high + 1;
 
     int i = low, j = high + 1;
 
-    // 기준이 되는 값을 선택한다.
+    // 기준이 되는 값.
     T pivot = values[low];
 
     for (;;) {
         // 배열의 왼쪽에서부터 오른쪽으로 살펴본다.
-        while (values[++i] < pivot) ;
+        while (SORT_LESS(values[++i], pivot))
+            if (i == high) break;
 
-        // 배열의 오른쪽에서부터 왼쪽으로 살펴본다. 
-        while (pivot < values[--j]) ;
+        // 배열의 오른쪽에서부터 왼쪽으로 살펴본다. (`values[low]`가 경계 역할을 한다.)
+        while (SORT_LESS(pivot, values[--j])) ;
 
         if (i >= j) break;
 
-        T value = values[i];
+        SORT_SWAP(values[i], values[j]);
+    }
+
+    SORT_SWAP(values[low], values[j]);
+
+    return j;
+}
+
+/* 
+    주어진 배열을 맨 앞의 원소 (기준 항목)보다 작은 값, 같은 값, 큰 값의 
+    세 부분으로 분할한다. (Bentley-McIlroy)
+
+    분할이 끝나면 `[*lt, *gt]` 구간의 원소들은 모두 기준 항목과 같다.
+*/
+static void quick_sort_partition_3way(T *values, int low, int high, int *lt, int *gt) {
+    int i = low, j = high + 1;
+
+    // 기준 항목과 같은 값은 분할하는 동안 배열의 양 끝 (`[low, p]`, `[q, high]`)에 모아 둔다.
+    int p = low, q = high + 1;
+
+    // 기준이 되는 값.
+    T pivot = values[low];
+
+    for (;;) {
+        // 배열의 왼쪽에서부터 오른쪽으로 살펴본다.
+        while (SORT_LESS(values[++i], pivot))
+            if (i == high) break;
+
+        // 배열의 오른쪽에서부터 왼쪽으로 살펴본다. (`values[low]`가 경계 역할을 한다.)
+        while (SORT_LESS(pivot, values[--j])) ;
+
+        if (i == j && !SORT_LESS(values[i], pivot) && !SORT_LESS(pivot, values[i])) {
+            p++;
+
+            SORT_SWAP(values[p], values[i]);
+        }
+
+        if (i >= j) break;
+
+        SORT_SWAP(values[i], values[j]);
+
+        // 맞바꾼 원소가 기준 항목과 같다면, 배열의 끝으로 옮긴다.
+        if (!SORT_LESS(values[i], pivot)) {
+            p++;
+
+            SORT_SWAP(values[p], values[i]);
+        }
 
-        values[i] = values[j];
-        values[j] = value;
+        if (!SORT_LESS(pivot, values[j])) {
+            q--;
+
+            SORT_SWAP(values[q], values[j]);
+        }
     }
 
-    T value = values[low];
+    // 양 끝에 모아 둔 같은 값들을 한가운데로 옮긴다.
+    i = j + 1;
 
-    values[low] = values[j];
-    values[j] = value;
+    for (int k = low; k <= p; k++, j--)
+        SORT_SWAP(values[k], values[j]);
 
-    return j;
+    for (int k = high; k >= q; k--, i++)
+        SORT_SWAP(values[k], values[i]);
+
+    *lt = j + 1, *gt = i - 1;
 }
 
 /* (주어진 배열을 퀵 정렬한다.) */
-static void quick_sort_helper(T *values, int low, int high) {
-    if (values == NULL || low >= high) return;
-
-    // 주어진 배열을 임의의 항목을 기준으로 적절하게 분할한다.
-    int j = quick_sort_partition(values, low, high);
+static void quick_sort_helper(T *values, int low, int high, int depth) {
+    while (high - low + 1 > QUICK_SORT_NETWORK_THRESHOLD) {
+        // 분할이 계속 한쪽으로 치우치면, 힙 정렬로 전환한다.
+        if (depth-- == 0) {
+            heap_sort(values + low, high - low + 1);
+
+            return;
+        }
+
+        quick_sort_select_pivot(values, low, high);
+
+        int lt, gt;
+
+        // 주어진 배열을 기준 항목을 중심으로 적절하게 분할한다.
+#if QUICK_SORT_THREE_WAY
+        /*
+            부분 배열의 바로 앞에 있는 원소는 이전 분할의 기준 항목이므로, 
+            부분 배열의 모든 원소보다 작거나 같다. 이번 기준 항목이 이 
+            원소와 같다면 같은 값이 많다는 뜻이므로, 이때만 3-way 분할을 
+            사용한다.
+        */
+        if (low > 0 && !SORT_LESS(values[low - 1], values[low]))
+            quick_sort_partition_3way(values, low, high, &lt, &gt);
+        else
+#endif
+            lt = gt = quick_sort_partition(values, low, high);
+
+        // 더 작은 쪽만 순환 호출하고, 더 큰 쪽은 반복문으로 처리한다.
+        if (lt - low < high - gt) {
+            quick_sort_helper(values, low, lt - 1, depth);
+
+            low = gt + 1;
+        } else {
+            quick_sort_helper(values, gt + 1, high, depth);
+
+            high = lt - 1;
+        }
+    }
 
-    quick_sort_helper(values, low, j - 1);
-    quick_sort_helper(values, j + 1, high);
+    // 크기가 작은 부분 배열은 정렬 네트워크로 마무리한다.
+    if (low < high) sorting_network_sort(values + low, high - low + 1);
 }
 
 /* 주어진 배열을 퀵 정렬한다. */
 void quick_sort(T *values, size_t n) {
     if (values == NULL || n <= 1) return;
 
-    // 분할 기준 항목의 무작위성을 위해 배열을 섞는다.
-    fisher_yates_shuffle(values, n);
+    /*
+        여기서는 인트로 정렬 (introsort)을 이용한다. 인트로 정렬은
+        퀵 정렬을 기반으로 하지만, 순환 호출의 깊이가 `2 * log n`을
+        넘어가면 힙 정렬로 전환하기 때문에 최악의 경우에도
+        `O(n * log n)`의 시간 복잡도를 보장한다.
+
+        기준 항목은 배열을 섞는 대신 세 값 또는 아홉 값의 중앙값으로
+        선택하고, 크기가 작은 부분 배열은 정렬 네트워크로 마무리한다.
+        또한, 더 작은 부분 배열만 순환 호출하기 때문에 스택의 깊이는
+        `O(log n)`을 넘지 않는다.
+    */
+
+    int depth = 0;
+
+    for (size_t m = n; m > 1; m >>= 1)
+        depth += 2;
+
+    quick_sort_helper(values, 0, n - 1, depth);
+}
+
+/* 다섯 개 이하의 원소로 이루어진 부분 배열을 삽입 정렬한다. */
+static void quick_sort_insertion(T *values, int low, int high) {
+    for (int i = low + 1; i <= high; i++)
+        for (int j = i; j > low && SORT_LESS(values[j], values[j - 1]); j--)
+            SORT_SWAP(values[j], values[j - 1]);
+}
+
+static void quick_sort_select_helper(T *values, int low, int high, int k, int depth);
+
+/* 
+    주어진 부분 배열에서 중앙값의 중앙값 (median of medians)을 구하여, 
+    부분 배열의 맨 앞으로 옮긴다.
+
+    이렇게 선택한 기준 항목보다 작은 원소와 큰 원소는 각각 전체의 
+    30% 이상이므로, 분할이 한쪽으로 치우치지 않는다.
+*/
+static void quick_sort_median_of_medians(T *values, int low, int high) {
+    int m = 0;
+
+    // 원소를 5개씩 묶어서, 각 묶음의 중앙값을 부분 배열의 앞쪽으로 모은다.
+    for (int i = low; i <= high; i += 5) {
+        int end = (high - i < 4) ? high : i + 4;
+
+        quick_sort_insertion(values, i, end);
+
+        SORT_SWAP(values[low + m], values[i + (end - i) / 2]);
+
+        m++;
+    }
+
+    // 중앙값들의 중앙값을 구한다.
+    quick_sort_select_helper(values, low, low + m - 1, low + (m - 1) / 2, 0);
+
+    SORT_SWAP(values[low], values[low + (m - 1) / 2]);
+}
+
+/* (주어진 배열에서 `k`번째로 작은 원소를 찾는다.) */
+static void quick_sort_select_helper(T *values, int low, int high, int k, int depth) {
+    while (high - low + 1 > QUICK_SORT_NETWORK_THRESHOLD) {
+        // 분할이 계속 한쪽으로 치우치면, 중앙값의 중앙값을 기준 항목으로 선택한다.
+        if (depth > 0) {
+            quick_sort_select_pivot(values, low, high);
+
+            depth--;
+        } else {
+            quick_sort_median_of_medians(values, low, high);
+        }
+
+        int j = quick_sort_partition(values, low, high);
+
+        if (j == k) return;
+
+        // `k`번째 원소가 있는 쪽만 계속 살펴본다.
+        if (k < j) high = j - 1;
+        else low = j + 1;
+    }
+
+    if (low < high) sorting_network_sort(values + low, high - low + 1);
+}
+
+/* 
+    주어진 배열에서 `k`번째로 작은 원소 (0부터 시작)를 찾아 `values[k]`에 놓는다. 
+    `values[k]`의 앞에는 그보다 작거나 같은 원소만, 뒤에는 크거나 같은 원소만 남는다.
+*/
+void quick_select(T *values, size_t n, size_t k) {
+    if (values == NULL || n <= 1 || k >= n) return;
+
+    /*
+        퀵 선택 (quickselect)은 퀵 정렬과 같은 방법으로 배열을 분할하지만,
+        찾는 원소가 있는 쪽만 계속 살펴보기 때문에 평균 `O(n)`의 시간에
+        `k`번째 원소를 찾을 수 있다.
+
+        여기서는 인트로 선택 (introselect)을 이용한다. 분할 횟수가 
+        `2 * log n`을 넘어가면 중앙값의 중앙값을 기준 항목으로 선택하기
+        때문에, 최악의 경우에도 `O(n)`의 시간 복잡도를 보장한다.
+    */
+
+    int depth = 0;
+
+    for (size_t m = n; m > 1; m >>= 1)
+        depth += 2;
+
+    quick_sort_select_helper(values, 0, n - 1, k, depth);
+}
+
+/* 주어진 배열에서 가장 작은 `k`개의 원소를 찾아, 배열의 앞쪽에 정렬된 순서로 놓는다. */
+void partial_sort(T *values, size_t n, size_t k) {
+    if (values == NULL || n <= 1 || k == 0) return;
+
+    if (k >= n) {
+        quick_sort(values, n);
+
+        return;
+    }
+
+    // `k - 1`번째 원소를 찾으면, 그 앞에는 가장 작은 `k - 1`개의 원소만 남는다.
+    quick_select(values, n, k - 1);
 
-    quick_sort_helper(values, 0, n - 1);
+    // 나머지 원소는 정렬하지 않는다.
+    quick_sort(values, k - 1);
 }
 
 #endif // `QUICK_SORT_IMPLEMENTATION`
\ No newline at end of file
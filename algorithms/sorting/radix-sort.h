@@ -0,0 +1,340 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* | 매크로 정의... | */
+
+/* 32비트 키를 정렬할 때 한 번에 살펴볼 비트의 개수. */
+#define RADIX_SORT_BITS_32     11
+
+/* 64비트 키를 정렬할 때 한 번에 살펴볼 비트의 개수. */
+#define RADIX_SORT_BITS_64     8
+
+/* 32비트 키를 정렬하는 데 필요한 단계의 수. */
+#define RADIX_SORT_PASSES_32   ((32 + RADIX_SORT_BITS_32 - 1) / RADIX_SORT_BITS_32)
+
+/* 64비트 키를 정렬하는 데 필요한 단계의 수. */
+#define RADIX_SORT_PASSES_64   ((64 + RADIX_SORT_BITS_64 - 1) / RADIX_SORT_BITS_64)
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* 정렬할 키의 종류. */
+typedef enum RadixSortKind {
+    RADIX_SORT_UNSIGNED,  // 부호 없는 정수.
+    RADIX_SORT_SIGNED,    // 부호 있는 정수. (2의 보수)
+    RADIX_SORT_FLOAT      // IEEE 754 부동 소수점 수.
+} RadixSortKind;
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 배열을 기수 정렬한다. */
+void radix_sort(T *values, size_t n);
+
+/* 부호 없는 32비트 정수 배열을 기수 정렬한다. */
+void radix_sort_u32(uint32_t *values, size_t n);
+
+/* 부호 없는 64비트 정수 배열을 기수 정렬한다. */
+void radix_sort_u64(uint64_t *values, size_t n);
+
+/* 부호 있는 32비트 정수 배열을 기수 정렬한다. */
+void radix_sort_i32(int32_t *values, size_t n);
+
+/* 부호 있는 64비트 정수 배열을 기수 정렬한다. */
+void radix_sort_i64(int64_t *values, size_t n);
+
+/* 32비트 부동 소수점 수 배열을 기수 정렬한다. */
+void radix_sort_f32(float *values, size_t n);
+
+/* 64비트 부동 소수점 수 배열을 기수 정렬한다. */
+void radix_sort_f64(double *values, size_t n);
+
+#endif // `RADIX_SORT_H`
+
+#if defined(RADIX_SORT_IMPLEMENTATION) && !defined(RADIX_SORT_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define RADIX_SORT_IMPLEMENTED
+
+/* | 라이브러리 함수... | */
+
+/* 
+    32비트 키의 비트를 뒤집어, 부호 없는 정수로서의 대소 관계가 원래의
+    대소 관계와 같아지도록 만든다.
+*/
+static inline uint32_t radix_sort_flip_32(uint32_t key, uint32_t sign_mask, uint32_t float_mask) {
+    return key ^ (sign_mask | (float_mask & (0u - (key >> 31))));
+}
+
+/* 
+    64비트 키의 비트를 뒤집어, 부호 없는 정수로서의 대소 관계가 원래의
+    대소 관계와 같아지도록 만든다.
+*/
+static inline uint64_t radix_sort_flip_64(uint64_t key, uint64_t sign_mask, uint64_t float_mask) {
+    return key ^ (sign_mask | (float_mask & (0u - (key >> 63))));
+}
+
+/* 32비트 키로 이루어진 배열을 기수 정렬한다. */
+static void radix_sort_32(void *values, size_t n, RadixSortKind kind) {
+    if (values == NULL || n <= 1) return;
+
+    const uint32_t radix = 1u << RADIX_SORT_BITS_32, mask = radix - 1;
+
+    /*
+        부호 있는 정수는 부호 비트를 뒤집으면 되고, 부동 소수점 수는
+        양수일 때는 부호 비트만, 음수일 때는 모든 비트를 뒤집으면 된다.
+        이렇게 뒤집은 키는 히스토그램을 만들거나 원소를 옮길 때만
+        사용하며, 배열에는 원래의 값을 그대로 저장한다.
+    */
+    const uint32_t sign_mask = (kind != RADIX_SORT_UNSIGNED) ? (1u << 31) : 0;
+    const uint32_t float_mask = (kind == RADIX_SORT_FLOAT) ? ~0u : 0;
+
+    size_t counts[RADIX_SORT_PASSES_32][1u << RADIX_SORT_BITS_32];
+
+    memset(counts, 0, sizeof counts);
+
+    unsigned char *src = values;
+
+    // 배열을 한 번만 읽어서, 모든 자릿수의 히스토그램을 만든다.
+    for (size_t i = 0; i < n; i++) {
+        uint32_t key;
+
+        memcpy(&key, src + i * sizeof key, sizeof key);
+
+        key = radix_sort_flip_32(key, sign_mask, float_mask);
+
+        for (int p = 0; p < RADIX_SORT_PASSES_32; p++)
+            counts[p][(key >> (p * RADIX_SORT_BITS_32)) & mask]++;
+    }
+
+    unsigned char *aux = NULL, *dst = NULL;
+
+    for (int p = 0; p < RADIX_SORT_PASSES_32; p++) {
+        const int shift = p * RADIX_SORT_BITS_32;
+
+        uint32_t first;
+
+        memcpy(&first, src, sizeof first);
+
+        // 모든 키의 자릿수가 같다면, 이 단계는 건너뛴다.
+        if (counts[p][(radix_sort_flip_32(first, sign_mask, float_mask) >> shift) & mask] == n)
+            continue;
+
+        if (aux == NULL) {
+            // 기수 정렬에 필요한 임시 메모리 공간을 할당한다.
+            aux = malloc(n * sizeof first);
+
+            if (aux == NULL) return;
+
+            dst = aux;
+        }
+
+        // 각 자릿수의 원소가 저장될 시작 위치를 계산한다.
+        size_t offset = 0;
+
+        for (uint32_t d = 0; d < radix; d++) {
+            size_t count = counts[p][d];
+
+            counts[p][d] = offset;
+            offset += count;
+        }
+
+        // 원소들을 자릿수에 맞는 위치로 옮긴다.
+        for (size_t i = 0; i < n; i++) {
+            uint32_t key;
+
+            memcpy(&key, src + i * sizeof key, sizeof key);
+
+            uint32_t digit = (radix_sort_flip_32(key, sign_mask, float_mask) >> shift) & mask;
+
+            memcpy(dst + (counts[p][digit]++) * sizeof key, &key, sizeof key);
+        }
+
+        // 원래 배열과 임시 메모리 공간의 역할을 서로 바꾼다.
+        unsigned char *temp = src;
+
+        src = dst;
+        dst = temp;
+    }
+
+    // 정렬된 결과가 임시 메모리 공간에 있다면, 원래 배열로 옮긴다.
+    if (src != values) memcpy(values, src, n * sizeof(uint32_t));
+
+    free(aux);
+}
+
+/* 64비트 키로 이루어진 배열을 기수 정렬한다. */
+static void radix_sort_64(void *values, size_t n, RadixSortKind kind) {
+    if (values == NULL || n <= 1) return;
+
+    const uint64_t radix = 1u << RADIX_SORT_BITS_64, mask = radix - 1;
+
+    const uint64_t sign_mask = (kind != RADIX_SORT_UNSIGNED) ? (1ull << 63) : 0;
+    const uint64_t float_mask = (kind == RADIX_SORT_FLOAT) ? ~0ull : 0;
+
+    size_t counts[RADIX_SORT_PASSES_64][1u << RADIX_SORT_BITS_64];
+
+    memset(counts, 0, sizeof counts);
+
+    unsigned char *src = values;
+
+    // 배열을 한 번만 읽어서, 모든 자릿수의 히스토그램을 만든다.
+    for (size_t i = 0; i < n; i++) {
+        uint64_t key;
+
+        memcpy(&key, src + i * sizeof key, sizeof key);
+
+        key = radix_sort_flip_64(key, sign_mask, float_mask);
+
+        for (int p = 0; p < RADIX_SORT_PASSES_64; p++)
+            counts[p][(key >> (p * RADIX_SORT_BITS_64)) & mask]++;
+    }
+
+    unsigned char *aux = NULL, *dst = NULL;
+
+    for (int p = 0; p < RADIX_SORT_PASSES_64; p++) {
+        const int shift = p * RADIX_SORT_BITS_64;
+
+        uint64_t first;
+
+        memcpy(&first, src, sizeof first);
+
+        // 모든 키의 자릿수가 같다면, 이 단계는 건너뛴다.
+        if (counts[p][(radix_sort_flip_64(first, sign_mask, float_mask) >> shift) & mask] == n)
+            continue;
+
+        if (aux == NULL) {
+            // 기수 정렬에 필요한 임시 메모리 공간을 할당한다.
+            aux = malloc(n * sizeof first);
+
+            if (aux == NULL) return;
+
+            dst = aux;
+        }
+
+        // 각 자릿수의 원소가 저장될 시작 위치를 계산한다.
+        size_t offset = 0;
+
+        for (uint64_t d = 0; d < radix; d++) {
+            size_t count = counts[p][d];
+
+            counts[p][d] = offset;
+            offset += count;
+        }
+
+        // 원소들을 자릿수에 맞는 위치로 옮긴다.
+        for (size_t i = 0; i < n; i++) {
+            uint64_t key;
+
+            memcpy(&key, src + i * sizeof key, sizeof key);
+
+            uint64_t digit = (radix_sort_flip_64(key, sign_mask, float_mask) >> shift) & mask;
+
+            memcpy(dst + (counts[p][digit]++) * sizeof key, &key, sizeof key);
+        }
+
+        // 원래 배열과 임시 메모리 공간의 역할을 서로 바꾼다.
+        unsigned char *temp = src;
+
+        src = dst;
+        dst = temp;
+    }
+
+    // 정렬된 결과가 임시 메모리 공간에 있다면, 원래 배열로 옮긴다.
+    if (src != values) memcpy(values, src, n * sizeof(uint64_t));
+
+    free(aux);
+}
+
+/* 주어진 배열을 기수 정렬한다. */
+void radix_sort(T *values, size_t n) {
+    /*
+        기수 정렬은 원소끼리 비교하는 대신, 키를 여러 개의 자릿수로 
+        나누고 가장 낮은 자릿수부터 차례대로 계수 정렬 (counting sort)을
+        반복하여 배열을 정렬하는 알고리즘이다. (LSD radix sort) 각 단계의
+        계수 정렬은 안정 정렬이기 때문에, 마지막 단계가 끝나면 배열의 
+        모든 원소가 정렬된다.
+
+        기수 정렬의 시간 복잡도는 `O(n * w)` (`w`는 단계의 수)로, 키의
+        크기가 고정된 정수나 부동 소수점 수 배열에서는 비교 기반 정렬
+        알고리즘보다 빠르지만, 배열의 크기에 비례하는 추가 메모리 공간이
+        필요하다.
+
+        여기서는 32비트 키를 11비트씩 3단계로 나누며, 히스토그램은 배열을
+        한 번만 읽어서 모든 단계의 것을 한꺼번에 만든다. 또한, 모든 키의
+        자릿수가 같은 단계 (예: 값의 범위가 작은 배열의 상위 비트)는 
+        건너뛴다.
+    */
+
+    radix_sort_32(values, n, RADIX_SORT_SIGNED);
+}
+
+/* 부호 없는 32비트 정수 배열을 기수 정렬한다. */
+void radix_sort_u32(uint32_t *values, size_t n) {
+    radix_sort_32(values, n, RADIX_SORT_UNSIGNED);
+}
+
+/* 부호 없는 64비트 정수 배열을 기수 정렬한다. */
+void radix_sort_u64(uint64_t *values, size_t n) {
+    radix_sort_64(values, n, RADIX_SORT_UNSIGNED);
+}
+
+/* 부호 있는 32비트 정수 배열을 기수 정렬한다. */
+void radix_sort_i32(int32_t *values, size_t n) {
+    radix_sort_32(values, n, RADIX_SORT_SIGNED);
+}
+
+/* 부호 있는 64비트 정수 배열을 기수 정렬한다. */
+void radix_sort_i64(int64_t *values, size_t n) {
+    radix_sort_64(values, n, RADIX_SORT_SIGNED);
+}
+
+/* 
+    32비트 부동 소수점 수 배열을 기수 정렬한다.
+
+    `-0.0f`는 `0.0f`보다 앞에 오며, NaN은 부호 비트에 따라 배열의 맨 앞 
+    또는 맨 뒤에 모인다.
+*/
+void radix_sort_f32(float *values, size_t n) {
+    radix_sort_32(values, n, RADIX_SORT_FLOAT);
+}
+
+/* 
+    64비트 부동 소수점 수 배열을 기수 정렬한다.
+
+    `-0.0`은 `0.0`보다 앞에 오며, NaN은 부호 비트에 따라 배열의 맨 앞 
+    또는 맨 뒤에 모인다.
+*/
+void radix_sort_f64(double *values, size_t n) {
+    radix_sort_64(values, n, RADIX_SORT_FLOAT);
+}
+
+#endif // `RADIX_SORT_IMPLEMENTATION`
\ No newline at end of file
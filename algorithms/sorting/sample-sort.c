@@ -0,0 +1,63 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#define SAMPLE_SORT_IMPLEMENTATION
+#include "sample-sort.h"
+
+/* `valgrind --tool=memcheck --leak-check=yes --show-reachable=yes --num-callers=20 ./bin/sample-sort.out` */
+
+int main(void) {
+    T values[] = { 50, 40, 20, 30, 10, 80, 60, 90, 70 };
+
+    size_t length = sizeof(values) / sizeof(*values);
+
+    sample_sort_parallel(values, length, 4);
+
+    for (int i = 0; i < length - 1; i++)
+        printf("%d, ", values[i]);
+
+    printf("%d\n", values[length - 1]);
+
+    // 스레드의 개수가 0 이하라면, 스레드를 사용하지 않고 정렬한다.
+    const size_t large_length = 300 * SAMPLE_SORT_MIN_CHUNK;
+
+    T *large_values = malloc(large_length * sizeof *large_values);
+
+    if (large_values == NULL) return 1;
+
+    for (int threads = 0; threads >= -1; threads--) {
+        for (size_t i = 0; i < large_length; i++)
+            large_values[i] = (T) (large_length - i);
+
+        sample_sort_parallel(large_values, large_length, threads);
+
+        size_t i = 1;
+
+        while (i < large_length && large_values[i - 1] <= large_values[i]) i++;
+
+        printf("threads = %d: %s\n", threads, (i == large_length) ? "sorted" : "not sorted");
+    }
+
+    free(large_values);
+
+    return 0;
+}
\ No newline at end of file
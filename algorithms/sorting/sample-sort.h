@@ -0,0 +1,338 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SAMPLE_SORT_H
+#define SAMPLE_SORT_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sort-random.h"
+
+/* | 매크로 정의... | */
+
+/* 스레드 하나가 맡을 부분 배열의 최소 크기. */
+#define SAMPLE_SORT_MIN_CHUNK     8192
+
+/* 샘플 정렬에 사용할 스레드의 최대 개수. */
+#define SAMPLE_SORT_MAX_THREADS   256
+
+/* 버킷의 최대 개수. (2의 거듭제곱이어야 한다.) */
+#define SAMPLE_SORT_MAX_BUCKETS   256
+
+/* 스레드 하나당 버킷의 개수. */
+#define SAMPLE_SORT_BUCKETS_PER_THREAD  8
+
+/* 분할 기준값 하나를 정하기 위해 뽑을 표본의 개수. */
+#define SAMPLE_SORT_OVERSAMPLING  16
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 여러 개의 스레드를 이용하여, 주어진 배열을 샘플 정렬한다. */
+void sample_sort_parallel(T *values, size_t n, int threads);
+
+#endif // `SAMPLE_SORT_H`
+
+#ifdef SAMPLE_SORT_IMPLEMENTATION
+
+#ifndef PDQ_SORT_IMPLEMENTATION
+#define PDQ_SORT_IMPLEMENTATION
+#endif
+
+#include "pdq-sort.h"
+
+/* | 자료형 선언 및 정의... | */
+
+/* 모든 스레드가 함께 사용하는 샘플 정렬의 상태를 나타내는 구조체. */
+typedef struct SampleSortContext {
+    T *values;              // 정렬할 배열.
+    T *aux;                 // 원소를 버킷별로 옮겨 담을 임시 메모리 공간.
+    unsigned char *oracle;  // 각 원소가 들어갈 버킷의 번호.
+    T *tree;                // 분할 기준값들로 만든 이진 탐색 트리. (1번부터 시작)
+    size_t *counts;         // 각 스레드가 맡은 구간의 버킷별 원소 개수.
+    size_t *bounds;         // 각 버킷의 시작 위치.
+    size_t n;               // 배열의 크기.
+    int log_buckets;        // 버킷 개수의 로그 값.
+    int buckets;            // 버킷의 개수.
+    int threads;            // 스레드의 개수.
+    int next_bucket;        // 다음에 정렬할 버킷의 번호.
+} SampleSortContext;
+
+/* 스레드 하나가 맡을 작업을 나타내는 구조체. */
+typedef struct SampleSortTask {
+    SampleSortContext *context;  // 샘플 정렬의 상태.
+    int index;                   // 스레드의 번호.
+} SampleSortTask;
+
+/* | 라이브러리 함수... | */
+
+/* 정렬된 분할 기준값들을 중위 순회 순서대로 트리에 배치한다. */
+static void sample_sort_build_tree(T *tree, const T *splitters, int node, int buckets, int *next) {
+    if (node >= buckets) return;
+
+    sample_sort_build_tree(tree, splitters, 2 * node, buckets, next);
+
+    tree[node] = splitters[(*next)++];
+
+    sample_sort_build_tree(tree, splitters, 2 * node + 1, buckets, next);
+}
+
+/* `index`번째 스레드가 맡을 구간의 시작 위치를 반환한다. */
+static size_t sample_sort_chunk(const SampleSortContext *context, int index) {
+    return (size_t) index * context->n / context->threads;
+}
+
+/* 주어진 구간의 원소들이 들어갈 버킷을 찾고, 버킷별 원소 개수를 센다. */
+static void *sample_sort_classify_worker(void *arg) {
+    SampleSortTask *task = arg;
+    SampleSortContext *context = task->context;
+
+    size_t *counts = context->counts + (size_t) task->index * context->buckets;
+
+    size_t low = sample_sort_chunk(context, task->index);
+    size_t high = sample_sort_chunk(context, task->index + 1);
+
+    const T *tree = context->tree;
+
+    for (size_t i = low; i < high; i++) {
+        T value = context->values[i];
+
+        size_t j = 1;
+
+        // 조건 분기 없이 트리를 따라 내려가며 버킷을 찾는다.
+        for (int l = 0; l < context->log_buckets; l++)
+            j = 2 * j + SORT_LESS(tree[j], value);
+
+        j -= context->buckets;
+
+        context->oracle[i] = (unsigned char) j;
+
+        counts[j]++;
+    }
+
+    return NULL;
+}
+
+/* 주어진 구간의 원소들을 각자의 버킷으로 옮긴다. */
+static void *sample_sort_scatter_worker(void *arg) {
+    SampleSortTask *task = arg;
+    SampleSortContext *context = task->context;
+
+    size_t *offsets = context->counts + (size_t) task->index * context->buckets;
+
+    size_t low = sample_sort_chunk(context, task->index);
+    size_t high = sample_sort_chunk(context, task->index + 1);
+
+    for (size_t i = low; i < high; i++)
+        context->aux[offsets[context->oracle[i]]++] = context->values[i];
+
+    return NULL;
+}
+
+/* 아직 정렬되지 않은 버킷을 하나씩 가져와서 정렬한다. */
+static void *sample_sort_bucket_worker(void *arg) {
+    SampleSortTask *task = arg;
+    SampleSortContext *context = task->context;
+
+    for (;;) {
+        int b = __atomic_fetch_add(&context->next_bucket, 1, __ATOMIC_RELAXED);
+
+        if (b >= context->buckets) break;
+
+        size_t low = context->bounds[b], length = context->bounds[b + 1] - low;
+
+        pdq_sort(context->aux + low, length);
+
+        memcpy(context->values + low, context->aux + low, length * sizeof *context->values);
+    }
+
+    return NULL;
+}
+
+/* 주어진 작업들을 여러 개의 스레드에서 동시에 실행한다. */
+static void sample_sort_run(void *(*func)(void *), SampleSortTask *tasks, int count) {
+    pthread_t handles[SAMPLE_SORT_MAX_THREADS];
+
+    int created[SAMPLE_SORT_MAX_THREADS] = { 0 };
+
+    // 첫 번째 작업은 현재 스레드에서 실행한다.
+    for (int t = 1; t < count; t++)
+        created[t] = (pthread_create(&handles[t], NULL, func, &tasks[t]) == 0);
+
+    func(&tasks[0]);
+
+    for (int t = 1; t < count; t++) {
+        // 스레드를 생성하지 못한 작업은 현재 스레드에서 실행한다.
+        if (created[t]) pthread_join(handles[t], NULL);
+        else func(&tasks[t]);
+    }
+}
+
+/* 여러 개의 스레드를 이용하여, 주어진 배열을 샘플 정렬한다. */
+void sample_sort_parallel(T *values, size_t n, int threads) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        샘플 정렬은 퀵 정렬을 일반화한 알고리즘으로, 하나의 기준 항목
+        대신 여러 개의 분할 기준값 (splitter)을 이용하여 배열을 한 번에
+        여러 개의 버킷으로 나눈다.
+
+        1. 배열에서 원소를 무작위로 넉넉하게 뽑아 (oversampling) 정렬한
+           다음, 일정한 간격으로 분할 기준값을 고른다.
+        2. 분할 기준값들로 완전 이진 트리를 만들고, 각 스레드는 자신이 
+           맡은 구간의 원소들이 들어갈 버킷을 조건 분기 없이 찾는다.
+        3. 버킷별 원소 개수를 모두 더해 각 스레드가 원소를 옮길 위치를 
+           계산한 다음, 각 스레드는 자신의 원소들을 버킷으로 옮긴다.
+        4. 각 버킷은 서로 독립적이므로, 여러 스레드가 버킷을 하나씩 
+           가져가서 패턴 무력화 퀵 정렬로 정렬한다.
+
+        같은 값이 아주 많은 배열에서는 그 값들이 모두 하나의 버킷에
+        모이기 때문에, 스레드 사이의 작업량이 고르지 않을 수 있다.
+    */
+
+    // 스레드의 개수가 1 이하이면, 스레드를 사용하지 않는다.
+    if (threads <= 1) {
+        pdq_sort(values, n);
+
+        return;
+    }
+
+    // 스레드의 개수가 양수일 때만 `size_t`로 변환하여 비교해야, 음수가 큰 값으로 바뀌지 않는다.
+    if ((size_t) threads > n / SAMPLE_SORT_MIN_CHUNK) 
+        threads = (int) (n / SAMPLE_SORT_MIN_CHUNK);
+
+    if (threads > SAMPLE_SORT_MAX_THREADS) 
+        threads = SAMPLE_SORT_MAX_THREADS;
+
+    // 배열의 크기가 작으면, 스레드를 사용하지 않는다.
+    if (threads <= 1) {
+        pdq_sort(values, n);
+
+        return;
+    }
+
+    SampleSortContext context = { .values = values, .n = n, .threads = threads };
+
+    // 버킷의 개수를 정한다.
+    for (context.buckets = 2, context.log_buckets = 1;
+         context.buckets < SAMPLE_SORT_BUCKETS_PER_THREAD * threads 
+         && context.buckets < SAMPLE_SORT_MAX_BUCKETS;
+         context.buckets *= 2, context.log_buckets++) ;
+
+    // 샘플 정렬에 필요한 메모리 공간을 할당한다.
+    context.aux = malloc(n * sizeof *context.aux);
+    context.oracle = malloc(n * sizeof *context.oracle);
+    context.counts = calloc((size_t) threads * context.buckets, sizeof *context.counts);
+
+    // 메모리 공간을 할당할 수 없다면, 스레드를 사용하지 않고 정렬한다.
+    if (context.aux == NULL || context.oracle == NULL || context.counts == NULL) {
+        free(context.aux);
+        free(context.oracle);
+        free(context.counts);
+
+        pdq_sort(values, n);
+
+        return;
+    }
+
+    T sample[SAMPLE_SORT_MAX_BUCKETS * SAMPLE_SORT_OVERSAMPLING];
+    T tree[SAMPLE_SORT_MAX_BUCKETS];
+
+    size_t bounds[SAMPLE_SORT_MAX_BUCKETS + 1];
+
+    int sample_size = context.buckets * SAMPLE_SORT_OVERSAMPLING;
+
+    SortRandom rng;
+
+    sort_random_init(&rng, n);
+
+    // 표본을 뽑아 정렬하고, 일정한 간격으로 분할 기준값을 고른다.
+    for (int i = 0; i < sample_size; i++)
+        sample[i] = values[sort_random_range(&rng, n)];
+
+    pdq_sort(sample, sample_size);
+
+    for (int i = 1; i < context.buckets; i++)
+        sample[i - 1] = sample[i * SAMPLE_SORT_OVERSAMPLING];
+
+    int next = 0;
+
+    sample_sort_build_tree(tree, sample, 1, context.buckets, &next);
+
+    context.tree = tree;
+    context.bounds = bounds;
+
+    SampleSortTask tasks[SAMPLE_SORT_MAX_THREADS];
+
+    for (int t = 0; t < threads; t++)
+        tasks[t] = (SampleSortTask) { .context = &context, .index = t };
+
+    // 각 원소가 들어갈 버킷을 찾는다.
+    sample_sort_run(sample_sort_classify_worker, tasks, threads);
+
+    // 각 스레드가 버킷별로 원소를 옮기기 시작할 위치를 계산한다.
+    size_t offset = 0;
+
+    for (int b = 0; b < context.buckets; b++) {
+        bounds[b] = offset;
+
+        for (int t = 0; t < threads; t++) {
+            size_t *count = &context.counts[(size_t) t * context.buckets + b];
+
+            size_t value = *count;
+
+            *count = offset;
+            offset += value;
+        }
+    }
+
+    bounds[context.buckets] = n;
+
+    // 원소들을 버킷으로 옮기고, 각 버킷을 정렬한다.
+    sample_sort_run(sample_sort_scatter_worker, tasks, threads);
+    sample_sort_run(sample_sort_bucket_worker, tasks, threads);
+
+    // 메모리 공간을 해제한다.
+    free(context.aux);
+    free(context.oracle);
+    free(context.counts);
+}
+
+#endif // `SAMPLE_SORT_IMPLEMENTATION`
\ No newline at end of file
@@ -26,6 +26,25 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+/* | 매크로 정의... | */
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+#ifndef SORT_SWAP
+
+/* 두 원소의 위치를 맞바꾼다. */
+#define SORT_SWAP(a, b)  do { T _value = (a); (a) = (b); (b) = _value; } while (0)
+
+#endif
+
 /* | 자료형 선언 및 정의... | */
 
 /* 정렬할 원소의 자료형. */
@@ -59,13 +78,10 @@ void selection_sort(T *values, size_t n) {
 
         // 가장 작은 항목을 찾는다.
         for (int j = i + 1; j < n; j++)
-            if (values[min_index] > values[j])
+            if (SORT_LESS(values[j], values[min_index]))
                 min_index = j;
-        
-        T min_value = values[min_index];
 
-        values[min_index] = values[i];
-        values[i] = min_value;
+        SORT_SWAP(values[min_index], values[i]);
     }
 }
 
@@ -26,6 +26,29 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+/* | 매크로 정의... | */
+
+/* 셸 정렬에 사용할 수 있는 간격 시퀀스의 종류. */
+#define SHELL_SORT_GAPS_CIURA      0
+#define SHELL_SORT_GAPS_TOKUDA     1
+#define SHELL_SORT_GAPS_SEDGEWICK  2
+#define SHELL_SORT_GAPS_KNUTH      3
+
+/* 셸 정렬에 사용할 간격 시퀀스. (컴파일할 때 `-DSHELL_SORT_GAPS=...`로 바꿀 수 있다.) */
+#ifndef SHELL_SORT_GAPS
+#define SHELL_SORT_GAPS  SHELL_SORT_GAPS_CIURA
+#endif
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
 /* | 자료형 선언 및 정의... | */
 
 /* 정렬할 원소의 자료형. */
@@ -40,6 +63,40 @@ void shell_sort(T *values, size_t n);
 
 #ifdef SHELL_SORT_IMPLEMENTATION
 
+/* | 전역 변수 정의... | */
+
+/* 
+    셸 정렬에 사용할 간격 시퀀스. 
+
+    간격 시퀀스에 따라 셸 정렬의 성능이 크게 달라지는데, 아직 최적의 
+    간격 시퀀스가 무엇인지는 알려져 있지 않다. 실험적으로는 Ciura와 
+    Tokuda의 간격 시퀀스가 가장 좋은 성능을 보여준다.
+*/
+static const size_t shell_sort_gaps[] = {
+#if SHELL_SORT_GAPS == SHELL_SORT_GAPS_CIURA
+    // Ciura (2001), 1750 이후는 이전 간격에 2.25를 곱하여 늘린다.
+    1, 4, 10, 23, 57, 132, 301, 701, 1750, 3937, 8858, 19930, 44842, 
+    100894, 227011, 510774, 1149241, 2585792, 5818032, 13090572, 
+    29453787, 66271020, 149109795, 335497038, 754868335, 1698453753
+#elif SHELL_SORT_GAPS == SHELL_SORT_GAPS_TOKUDA
+    // Tokuda (1992), `ceil((9^k - 4^k) / (5 * 4^(k - 1)))`
+    1, 4, 9, 20, 46, 103, 233, 525, 1182, 2660, 5985, 13467, 30301, 
+    68178, 153401, 345152, 776591, 1747331, 3931496, 8845866, 19903198, 
+    44782196, 100759940, 226709866, 510097200, 1147718700, 2582367076
+#elif SHELL_SORT_GAPS == SHELL_SORT_GAPS_SEDGEWICK
+    // Sedgewick (1986), `4^k + 3 * 2^(k - 1) + 1`, `O(n^(4/3))`
+    1, 8, 23, 77, 281, 1073, 4193, 16577, 65921, 262913, 1050113, 
+    4197377, 16783361, 67121153, 268460033, 1073790977
+#elif SHELL_SORT_GAPS == SHELL_SORT_GAPS_KNUTH
+    // Knuth (1973), `(3^k - 1) / 2`, `O(n^(3/2))`
+    1, 4, 13, 40, 121, 364, 1093, 3280, 9841, 29524, 88573, 265720, 
+    797161, 2391484, 7174453, 21523360, 64570081, 193710244, 581130733, 
+    1743392200
+#else
+#error "SHELL_SORT_GAPS must be one of SHELL_SORT_GAPS_CIURA, _TOKUDA, _SEDGEWICK or _KNUTH"
+#endif
+};
+
 /* | 라이브러리 함수... | */
 
 /* 주어진 배열을 셸 정렬한다. */
@@ -58,25 +115,28 @@ void shell_sort(T *values, size_t n) {
         사용해볼 수 있다.
     */
 
-    // 삽입 정렬의 간격.
-    int h = 1;
+    // 배열의 크기보다 작은 간격 중에 가장 큰 간격부터 시작한다.
+    size_t k = sizeof shell_sort_gaps / sizeof *shell_sort_gaps;
+
+    while (k > 1 && shell_sort_gaps[k - 1] >= n)
+        k--;
 
-    // 여기서는 `O(n^(3/2))`의 Knuth's Sequence를 이용한다.
-    while (h < n / 3) 
-        h = 3 * h + 1; // 1, 4, 13, 40, 121, 364, ...
+    while (k > 0) {
+        // 삽입 정렬의 간격.
+        size_t h = shell_sort_gaps[--k];
 
-    while (h >= 1) {
         // 배열을 h-정렬한다.
-        for (int i = h; i < n; i++) {
-            for (int j = i; j >= h && values[j] < values[j - h]; j -= h) {
-                T value = values[j];
+        for (size_t i = h; i < n; i++) {
+            T value = values[i];
 
-                values[j] = values[j - 1];
-                values[j - 1] = value;
-            }
-        }
+            size_t j = i;
+
+            // 원소를 맞바꾸는 대신, 선택한 원소보다 큰 원소들을 h칸씩 오른쪽으로 민다.
+            for (; j >= h && SORT_LESS(value, values[j - h]); j -= h)
+                values[j] = values[j - h];
 
-        h /= 3;
+            values[j] = value;
+        }
     }
 }
 
@@ -0,0 +1,230 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SORT_AUTO_H
+#define SORT_AUTO_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "counting-sort.h"
+#include "insertion-sort.h"
+#include "pdq-sort.h"
+#include "radix-sort.h"
+#include "tim-sort.h"
+
+/* | 매크로 정의... | */
+
+/* 삽입 정렬을 사용할 배열의 최대 크기. */
+#define SORT_AUTO_INSERTION_THRESHOLD  16
+
+/* 입력 배열의 특성을 추정할 배열의 최소 크기. (이보다 작으면 표본을 뽑는 비용이 더 크다.) */
+#define SORT_AUTO_SAMPLE_THRESHOLD     1024
+
+/* 입력 배열의 특성을 추정하기 위해 살펴볼 위치의 개수. */
+#define SORT_AUTO_SAMPLE_SIZE          64
+
+/* 기수 정렬을 사용할 배열의 최소 크기. */
+#define SORT_AUTO_RADIX_THRESHOLD      4096
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* 표본으로 추정한 입력 배열의 특성을 나타내는 구조체. */
+typedef struct SortAutoStats {
+    size_t samples;    // 살펴본 위치의 개수.
+    size_t monotone;   // 연속된 세 원소가 한 방향으로 정렬되어 있던 위치의 개수.
+    size_t distinct;   // 표본에서 서로 다른 값의 개수.
+    T min;             // 표본에서 가장 작은 값.
+    T max;             // 표본에서 가장 큰 값.
+} SortAutoStats;
+
+/* | 라이브러리 함수... | */
+
+/* 입력 배열의 특성에 따라 알맞은 정렬 알고리즘을 선택하여, 주어진 배열을 정렬한다. */
+void sort_auto(T *values, size_t n);
+
+#endif // `SORT_AUTO_H`
+
+#if defined(SORT_AUTO_IMPLEMENTATION) && !defined(SORT_AUTO_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define SORT_AUTO_IMPLEMENTED
+
+#ifndef COUNTING_SORT_IMPLEMENTATION
+#define COUNTING_SORT_IMPLEMENTATION
+#endif
+
+#include "counting-sort.h"
+
+#ifndef INSERTION_SORT_IMPLEMENTATION
+#define INSERTION_SORT_IMPLEMENTATION
+#endif
+
+#include "insertion-sort.h"
+
+#ifndef PDQ_SORT_IMPLEMENTATION
+#define PDQ_SORT_IMPLEMENTATION
+#endif
+
+#include "pdq-sort.h"
+
+#ifndef RADIX_SORT_IMPLEMENTATION
+#define RADIX_SORT_IMPLEMENTATION
+#endif
+
+#include "radix-sort.h"
+
+#ifndef TIM_SORT_IMPLEMENTATION
+#define TIM_SORT_IMPLEMENTATION
+#endif
+
+#include "tim-sort.h"
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 배열에서 고르게 뽑은 표본으로, 배열의 특성을 추정한다. */
+static SortAutoStats sort_auto_sample(const T *values, size_t n) {
+    SortAutoStats result = { .samples = SORT_AUTO_SAMPLE_SIZE };
+
+    size_t step = (n - 2) / SORT_AUTO_SAMPLE_SIZE;
+
+    T sample[SORT_AUTO_SAMPLE_SIZE];
+
+    for (size_t i = 0; i < result.samples; i++) {
+        size_t p = i * step;
+
+        T a = values[p], b = values[p + 1], c = values[p + 2];
+
+        // 런의 길이를 추정하기 위해, 연속된 세 원소의 방향이 바뀌는지 확인한다.
+        if ((!SORT_LESS(b, a) && !SORT_LESS(c, b)) || (SORT_LESS(b, a) && SORT_LESS(c, b)))
+            result.monotone++;
+
+        // 표본을 삽입 정렬하면서 모은다.
+        size_t j = i;
+
+        for (; j > 0 && SORT_LESS(a, sample[j - 1]); j--)
+            sample[j] = sample[j - 1];
+
+        sample[j] = a;
+    }
+
+    result.distinct = 1;
+
+    for (size_t i = 1; i < result.samples; i++)
+        if (SORT_LESS(sample[i - 1], sample[i])) result.distinct++;
+
+    result.min = sample[0];
+    result.max = sample[result.samples - 1];
+
+    return result;
+}
+
+/* 입력 배열의 특성에 따라 알맞은 정렬 알고리즘을 선택하여, 주어진 배열을 정렬한다. */
+void sort_auto(T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        정렬 알고리즘마다 잘 맞는 입력 배열이 다르다. 예를 들어, 팀 정렬은
+        이미 정렬된 배열을 선형 시간에 정렬하지만 무작위 배열에서는 패턴
+        무력화 퀵 정렬보다 두세 배 느리고, 계수 정렬은 값의 범위가 좁을 
+        때만 사용할 수 있다.
+
+        여기서는 배열 전체에서 고르게 뽑은 64개의 위치만 살펴서 배열의 
+        특성을 추정한 다음, 벤치마크 결과를 바탕으로 정렬 알고리즘을 
+        선택한다.
+
+        1. 배열의 크기가 아주 작으면 삽입 정렬을, 표본을 뽑을 만큼 크지 
+           않으면 패턴 무력화 퀵 정렬을 사용한다.
+        2. 연속된 세 원소가 거의 모든 위치에서 한 방향으로 정렬되어 
+           있다면, 긴 런을 찾아 합치는 팀 정렬을 사용한다.
+        3. 값의 범위가 배열의 크기보다 작으면, 계수 정렬을 사용한다.
+        4. 같은 값이 많으면, 같은 값을 한 번에 처리하는 패턴 무력화 퀵 
+           정렬을 사용한다.
+        5. 배열의 크기가 크면 기수 정렬을, 그렇지 않으면 패턴 무력화 퀵
+           정렬을 사용한다.
+
+        계수 정렬과 기수 정렬은 원소의 값을 직접 사용하므로, `SORT_LESS`가 
+        기본 비교 연산자를 사용할 때만 선택한다. 또한, 표본은 배열의 일부일
+        뿐이므로 추정이 틀릴 수 있지만, 계수 정렬은 실제 값의 범위가 넓으면
+        스스로 패턴 무력화 퀵 정렬을 사용하고, 나머지 알고리즘은 어떤 
+        배열에서도 `O(n * log n)`의 시간 복잡도를 보장한다.
+    */
+
+    if (n <= SORT_AUTO_INSERTION_THRESHOLD) {
+        insertion_sort(values, n);
+
+        return;
+    }
+
+    if (n < SORT_AUTO_SAMPLE_THRESHOLD) {
+        pdq_sort(values, n);
+
+        return;
+    }
+
+    SortAutoStats stats = sort_auto_sample(values, n);
+
+    // 표본이 모두 한 방향으로 정렬되어 있다면, 배열은 거의 정렬되어 있을 가능성이 높다.
+    if (stats.monotone == stats.samples) {
+        tim_sort(values, n);
+
+        return;
+    }
+
+#ifdef SORT_LESS_DEFAULT
+    unsigned long long span = (unsigned long long) stats.max - (unsigned long long) stats.min;
+
+    if (span < n && span < COUNTING_SORT_MAX_RANGE) {
+        counting_sort(values, n);
+
+        return;
+    }
+#endif
+
+    if (stats.monotone >= stats.samples - stats.samples / 16) {
+        tim_sort(values, n);
+
+        return;
+    }
+
+    if (stats.distinct <= stats.samples / 4) {
+        pdq_sort(values, n);
+
+        return;
+    }
+
+#ifdef SORT_LESS_DEFAULT
+    if (n >= SORT_AUTO_RADIX_THRESHOLD) {
+        radix_sort(values, n);
+
+        return;
+    }
+#endif
+
+    pdq_sort(values, n);
+}
+
+#endif // `SORT_AUTO_IMPLEMENTATION`
\ No newline at end of file
@@ -0,0 +1,54 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#include "sort-define.h"
+
+/* 정수 배열을 오름차순으로 정렬하는 함수들을 만든다. */
+SORT_DEFINE(int, int, a < b)
+
+/* 실수 배열을 내림차순으로 정렬하는 함수들을 만든다. */
+SORT_DEFINE(double_desc, double, a > b)
+
+/* `valgrind --tool=memcheck --leak-check=yes --show-reachable=yes --num-callers=20 ./bin/sort-define.out` */
+
+int main(void) {
+    int values[] = { 50, 40, 20, 30, 10, 80, 60, 90, 70 };
+
+    double reals[] = { 0.5, 0.4, 0.2, 0.3, 0.1, 0.8, 0.6, 0.9, 0.7 };
+
+    size_t length = sizeof(values) / sizeof(*values);
+
+    int_quick_sort(values, length);
+    double_desc_merge_sort(reals, length);
+
+    for (int i = 0; i < length - 1; i++)
+        printf("%d, ", values[i]);
+
+    printf("%d\n", values[length - 1]);
+
+    for (int i = 0; i < length - 1; i++)
+        printf("%.1f, ", reals[i]);
+
+    printf("%.1f\n", reals[length - 1]);
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,280 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SORT_DEFINE_H
+#define SORT_DEFINE_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+    다른 정렬 헤더 파일은 원소의 자료형이 `T`로 고정되어 있으므로, 
+    다른 자료형의 배열을 정렬하려면 헤더 파일을 복사하거나, 비교 함수를 
+    인라인할 수 없는 `qsort()`를 사용해야 한다.
+
+    `SORT_DEFINE(name, type, less_expr)`는 주어진 자료형과 비교 식에 
+    맞는 정렬 함수들을 `static inline` 함수로 만들어 준다. 비교 식에서는
+    비교할 두 원소를 `a`와 `b`로 나타내며, `a`가 `b`보다 먼저 와야 할 
+    때 참이 되어야 한다. 함수의 이름은 모두 `name`으로 시작하므로, 
+    하나의 번역 단위에서 여러 번 사용할 수 있다.
+
+    ```c
+    SORT_DEFINE(dbl, double, a < b)
+    SORT_DEFINE(point, Point, (a.x < b.x) || (a.x == b.x && a.y < b.y))
+
+    dbl_quick_sort(values, n);
+    point_merge_sort(points, n);
+    ```
+
+    `name_insertion_sort()`, `name_heap_sort()`, `name_quick_sort()`, 
+    `name_merge_sort()`가 만들어지며, 필요한 함수만 만들려면 
+    `SORT_DEFINE_LESS()` 다음에 `SORT_DEFINE_*_SORT()`를 따로 사용하면 
+    된다. (`name_quick_sort()`에는 삽입 정렬과 힙 정렬이, 
+    `name_merge_sort()`에는 삽입 정렬이 필요하다.)
+*/
+
+/* | 매크로 정의... | */
+
+/* 삽입 정렬로 마무리할 부분 배열의 최대 크기. */
+#define SORT_DEFINE_INSERTION_THRESHOLD  24
+
+/* 9개의 원소로 기준 항목을 선택 (ninther)할 부분 배열의 최소 크기. */
+#define SORT_DEFINE_NINTHER_THRESHOLD    128
+
+/* 병합 정렬의 첫 단계에서 삽입 정렬할 런의 크기. */
+#define SORT_DEFINE_RUN_SIZE             32
+
+/* 비교 함수 `name_less()`와 교환 함수 `name_swap()`을 만든다. */
+#define SORT_DEFINE_LESS(name, type, less_expr)                                 \
+    /* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */                      \
+    static inline int name##_less(type a, type b) {                             \
+        return (less_expr);                                                     \
+    }                                                                           \
+                                                                                \
+    /* 두 원소의 위치를 맞바꾼다. */                                            \
+    static inline void name##_swap(type *a, type *b) {                          \
+        type value = *a;                                                        \
+                                                                                \
+        *a = *b;                                                                \
+        *b = value;                                                             \
+    }
+
+/* 삽입 정렬 함수 `name_insertion_sort()`를 만든다. */
+#define SORT_DEFINE_INSERTION_SORT(name, type)                                               \
+    /* 부분 배열 `[low, high)`를 삽입 정렬한다. */                                           \
+    static inline void name##_insertion_sort_range(type *values, size_t low, size_t high) {  \
+        for (size_t i = low + 1; i < high; i++) {                                            \
+            type value = values[i];                                                          \
+                                                                                             \
+            size_t j = i;                                                                    \
+                                                                                             \
+            for (; j > low && name##_less(value, values[j - 1]); j--)                        \
+                values[j] = values[j - 1];                                                   \
+                                                                                             \
+            values[j] = value;                                                               \
+        }                                                                                    \
+    }                                                                                        \
+                                                                                             \
+    /* 주어진 배열을 삽입 정렬한다. */                                                       \
+    static inline void name##_insertion_sort(type *values, size_t n) {                       \
+        if (values == NULL || n <= 1) return;                                                \
+                                                                                             \
+        name##_insertion_sort_range(values, 0, n);                                           \
+    }
+
+/* 힙 정렬 함수 `name_heap_sort()`를 만든다. */
+#define SORT_DEFINE_HEAP_SORT(name, type)                                        \
+    /* 최대 힙에서 `i`번째 원소를 아래로 내려보낸다. */                          \
+    static inline void name##_sift_down(type *values, size_t i, size_t n) {      \
+        type value = values[i];                                                  \
+                                                                                 \
+        for (;;) {                                                               \
+            size_t child = 2 * i + 1;                                            \
+                                                                                 \
+            if (child >= n) break;                                               \
+                                                                                 \
+            if (child + 1 < n && name##_less(values[child], values[child + 1]))  \
+                child++;                                                         \
+                                                                                 \
+            if (!name##_less(value, values[child])) break;                       \
+                                                                                 \
+            values[i] = values[child];                                           \
+                                                                                 \
+            i = child;                                                           \
+        }                                                                        \
+                                                                                 \
+        values[i] = value;                                                       \
+    }                                                                            \
+                                                                                 \
+    /* 주어진 배열을 힙 정렬한다. */                                             \
+    static inline void name##_heap_sort(type *values, size_t n) {                \
+        if (values == NULL || n <= 1) return;                                    \
+                                                                                 \
+        for (size_t i = n / 2; i-- > 0; )                                        \
+            name##_sift_down(values, i, n);                                      \
+                                                                                 \
+        for (size_t i = n - 1; i > 0; i--) {                                     \
+            name##_swap(&values[0], &values[i]);                                 \
+                                                                                 \
+            name##_sift_down(values, 0, i);                                      \
+        }                                                                        \
+    }
+
+/* 퀵 정렬 (인트로 정렬) 함수 `name_quick_sort()`를 만든다. */
+#define SORT_DEFINE_QUICK_SORT(name, type)                                                           \
+    /* 세 원소를 정렬하여, 중앙값이 `j`번째 위치에 오도록 한다. */                                   \
+    static inline void name##_sort3(type *values, size_t i, size_t j, size_t k) {                    \
+        if (name##_less(values[j], values[i])) name##_swap(&values[i], &values[j]);                  \
+        if (name##_less(values[k], values[j])) name##_swap(&values[j], &values[k]);                  \
+        if (name##_less(values[j], values[i])) name##_swap(&values[i], &values[j]);                  \
+    }                                                                                                \
+                                                                                                     \
+    /* (부분 배열 `[low, high)`를 퀵 정렬한다.) */                                                   \
+    static inline void name##_quick_sort_helper(type *values, size_t low, size_t high, int depth) {  \
+        while (high - low > SORT_DEFINE_INSERTION_THRESHOLD) {                                       \
+            /* 분할이 계속 한쪽으로 치우치면, 힙 정렬로 전환한다. */                                 \
+            if (depth-- == 0) {                                                                      \
+                name##_heap_sort(values + low, high - low);                                          \
+                                                                                                     \
+                return;                                                                              \
+            }                                                                                        \
+                                                                                                     \
+            size_t n = high - low, mid = low + n / 2, last = high - 1;                               \
+                                                                                                     \
+            /* 세 값 또는 아홉 값의 중앙값을 기준 항목으로 선택한다. */                              \
+            if (n > SORT_DEFINE_NINTHER_THRESHOLD) {                                                 \
+                size_t s = n / 8;                                                                    \
+                                                                                                     \
+                name##_sort3(values, low, low + s, low + 2 * s);                                     \
+                name##_sort3(values, mid - s, mid, mid + s);                                         \
+                name##_sort3(values, last - 2 * s, last - s, last);                                  \
+                name##_sort3(values, low + s, mid, last - s);                                        \
+            } else {                                                                                 \
+                name##_sort3(values, low, mid, last);                                                \
+            }                                                                                        \
+                                                                                                     \
+            name##_swap(&values[low], &values[mid]);                                                 \
+                                                                                                     \
+            type pivot = values[low];                                                                \
+                                                                                                     \
+            size_t i = low, j = high;                                                                \
+                                                                                                     \
+            for (;;) {                                                                               \
+                while (name##_less(values[++i], pivot))                                              \
+                    if (i == last) break;                                                            \
+                                                                                                     \
+                while (name##_less(pivot, values[--j])) ;                                            \
+                                                                                                     \
+                if (i >= j) break;                                                                   \
+                                                                                                     \
+                name##_swap(&values[i], &values[j]);                                                 \
+            }                                                                                        \
+                                                                                                     \
+            name##_swap(&values[low], &values[j]);                                                   \
+                                                                                                     \
+            /* 더 작은 쪽만 순환 호출하고, 더 큰 쪽은 반복문으로 처리한다. */                        \
+            if (j - low < high - (j + 1)) {                                                          \
+                name##_quick_sort_helper(values, low, j, depth);                                     \
+                                                                                                     \
+                low = j + 1;                                                                         \
+            } else {                                                                                 \
+                name##_quick_sort_helper(values, j + 1, high, depth);                                \
+                                                                                                     \
+                high = j;                                                                            \
+            }                                                                                        \
+        }                                                                                            \
+                                                                                                     \
+        name##_insertion_sort_range(values, low, high);                                              \
+    }                                                                                                \
+                                                                                                     \
+    /* 주어진 배열을 퀵 정렬한다. (인트로 정렬) */                                                   \
+    static inline void name##_quick_sort(type *values, size_t n) {                                   \
+        if (values == NULL || n <= 1) return;                                                        \
+                                                                                                     \
+        int depth = 0;                                                                               \
+                                                                                                     \
+        for (size_t m = n; m > 1; m >>= 1)                                                           \
+            depth += 2;                                                                              \
+                                                                                                     \
+        name##_quick_sort_helper(values, 0, n, depth);                                               \
+    }
+
+/* 병합 정렬 함수 `name_merge_sort()`를 만든다. */
+#define SORT_DEFINE_MERGE_SORT(name, type)                                                    \
+    /* 주어진 배열을 상향식으로 병합 정렬한다. (안정 정렬) */                                 \
+    static inline void name##_merge_sort(type *values, size_t n) {                            \
+        if (values == NULL || n <= 1) return;                                                 \
+                                                                                              \
+        type *aux = NULL;                                                                     \
+                                                                                              \
+        if (n > SORT_DEFINE_RUN_SIZE) {                                                       \
+            aux = malloc(n * sizeof *aux);                                                    \
+                                                                                              \
+            if (aux == NULL) return;                                                          \
+        }                                                                                     \
+                                                                                              \
+        /* 작은 런은 삽입 정렬로 정렬한다. */                                                 \
+        for (size_t low = 0; low < n; low += SORT_DEFINE_RUN_SIZE) {                          \
+            size_t high = (n - low < SORT_DEFINE_RUN_SIZE) ? n : low + SORT_DEFINE_RUN_SIZE;  \
+                                                                                              \
+            name##_insertion_sort_range(values, low, high);                                   \
+        }                                                                                     \
+                                                                                              \
+        type *src = values, *dst = aux;                                                       \
+                                                                                              \
+        /* 두 배열을 번갈아 가며, 인접한 런끼리 합친다. */                                    \
+        for (size_t width = SORT_DEFINE_RUN_SIZE; width < n; width *= 2) {                    \
+            for (size_t low = 0; low < n; low += 2 * width) {                                 \
+                size_t mid = (n - low < width) ? n : low + width;                             \
+                size_t high = (n - mid < width) ? n : mid + width;                            \
+                                                                                              \
+                size_t i = low, j = mid, k = low;                                             \
+                                                                                              \
+                while (i < mid && j < high)                                                   \
+                    dst[k++] = name##_less(src[j], src[i]) ? src[j++] : src[i++];             \
+                                                                                              \
+                memcpy(dst + k, src + i, (mid - i) * sizeof *dst);                            \
+                memcpy(dst + k + (mid - i), src + j, (high - j) * sizeof *dst);               \
+            }                                                                                 \
+                                                                                              \
+            type *temp = src;                                                                 \
+                                                                                              \
+            src = dst;                                                                        \
+            dst = temp;                                                                       \
+        }                                                                                     \
+                                                                                              \
+        if (src != values) memcpy(values, src, n * sizeof *values);                           \
+                                                                                              \
+        free(aux);                                                                            \
+    }
+
+/* 주어진 자료형과 비교 식에 맞는 모든 정렬 함수를 만든다. */
+#define SORT_DEFINE(name, type, less_expr)                                      \
+    SORT_DEFINE_LESS(name, type, less_expr)                                     \
+    SORT_DEFINE_INSERTION_SORT(name, type)                                      \
+    SORT_DEFINE_HEAP_SORT(name, type)                                           \
+    SORT_DEFINE_QUICK_SORT(name, type)                                          \
+    SORT_DEFINE_MERGE_SORT(name, type)
+
+#endif // `SORT_DEFINE_H`
\ No newline at end of file
@@ -0,0 +1,159 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SORT_RANDOM_H
+#define SORT_RANDOM_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+    무작위성이 필요한 알고리즘 (샘플 정렬, 벤치마크의 입력 배열 생성 등)에서
+    사용하는 작은 의사 난수 생성기. 
+
+    `rand()`는 느리고, 값의 범위가 좁으며, 모든 스레드가 하나의 전역 
+    상태를 공유한다. 여기서는 호출하는 쪽에서 `SortRandom` 구조체를 
+    직접 가지고 다니므로, 스레드마다 따로 상태를 두면 서로 경쟁하지 
+    않는다. 함수는 모두 작기 때문에 `static inline` 함수로 정의한다.
+
+    ```c
+    SortRandom rng;
+
+    sort_random_init(&rng, seed);
+
+    size_t i = sort_random_range(&rng, n);  // `[0, n)` 범위의 난수
+    ```
+*/
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* 의사 난수 생성기의 상태를 나타내는 구조체. (xoshiro256**) */
+typedef struct SortRandom {
+    uint64_t state[4];
+} SortRandom;
+
+/* | 라이브러리 함수... | */
+
+/* `value`를 왼쪽으로 `k`비트만큼 회전한다. */
+static inline uint64_t sort_random_rotl(uint64_t value, int k) {
+    return (value << k) | (value >> (64 - k));
+}
+
+/* 주어진 시드 값으로 의사 난수 생성기를 초기화한다. */
+static inline void sort_random_init(SortRandom *rng, uint64_t seed) {
+    // 시드 값이 비슷하더라도 상태가 크게 달라지도록, SplitMix64로 상태를 채운다.
+    for (int i = 0; i < 4; i++) {
+        uint64_t z = (seed += 0x9E3779B97F4A7C15ULL);
+
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+        rng->state[i] = z ^ (z >> 31);
+    }
+}
+
+/* 다음 64비트 난수를 반환한다. */
+static inline uint64_t sort_random_next(SortRandom *rng) {
+    uint64_t *s = rng->state;
+
+    const uint64_t result = sort_random_rotl(s[1] * 5, 7) * 9;
+
+    const uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+
+    s[2] ^= t;
+
+    s[3] = sort_random_rotl(s[3], 45);
+
+    return result;
+}
+
+/* 두 64비트 정수를 곱하여, 128비트 결과의 상위 64비트와 하위 64비트를 구한다. */
+static inline uint64_t sort_random_mul(uint64_t a, uint64_t b, uint64_t *low) {
+#ifdef __SIZEOF_INT128__
+    unsigned __int128 product = (unsigned __int128) a * b;
+
+    *low = (uint64_t) product;
+
+    return (uint64_t) (product >> 64);
+#else
+    uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+
+    uint64_t lo_lo = a_lo * b_lo, hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi, hi_hi = a_hi * b_hi;
+
+    uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFF) + lo_hi;
+
+    *low = (cross << 32) | (lo_lo & 0xFFFFFFFF);
+
+    return (hi_lo >> 32) + (cross >> 32) + hi_hi;
+#endif
+}
+
+/* `[0, n)` 범위의 난수를 반환한다. (`n`은 0보다 커야 한다.) */
+static inline uint64_t sort_random_range(SortRandom *rng, uint64_t n) {
+    /*
+        `next() % n`은 나눗셈이 느리고, `n`이 2의 거듭제곱이 아니면 작은 
+        값이 더 자주 나온다. 대신 64비트 난수에 `n`을 곱한 128비트 결과의
+        상위 64비트를 사용하면 나눗셈 없이 `[0, n)` 범위로 줄일 수 있다.
+        하위 64비트가 `2^64 mod n`보다 작은 경우만 다시 뽑으면 모든 값이 
+        같은 확률로 나오며, 다시 뽑아야 하는 경우는 거의 없으므로 이때만 
+        나눗셈을 한다. (Lemire)
+    */
+
+    uint64_t low, high = sort_random_mul(sort_random_next(rng), n, &low);
+
+    if (low < n) {
+        const uint64_t threshold = (0 - n) % n;
+
+        while (low < threshold)
+            high = sort_random_mul(sort_random_next(rng), n, &low);
+    }
+
+    return high;
+}
+
+/* 주어진 배열의 원소들을 무작위로 섞는다. (Fisher-Yates) */
+static inline void sort_random_shuffle(SortRandom *rng, T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = (size_t) sort_random_range(rng, (uint64_t) i + 1);
+
+        T value = values[i];
+
+        values[i] = values[j];
+        values[j] = value;
+    }
+}
+
+#endif // `SORT_RANDOM_H`
\ No newline at end of file
@@ -0,0 +1,266 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef SORTING_NETWORK_H
+#define SORTING_NETWORK_H
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* | 매크로 정의... | */
+
+/* 정렬 네트워크로 정렬할 수 있는 배열의 최대 크기. */
+#define SORTING_NETWORK_MAX_SIZE  64
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 배열을 정렬 네트워크로 정렬한다. */
+void sorting_network_sort(T *values, size_t n);
+
+#endif // `SORTING_NETWORK_H`
+
+#if defined(SORTING_NETWORK_IMPLEMENTATION) && !defined(SORTING_NETWORK_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define SORTING_NETWORK_IMPLEMENTED
+
+/* 
+    기본 비교 연산자로 `int` 배열을 정렬할 때는 AVX2 명령어를 사용한다.
+    AVX2를 지원하지 않는 CPU에서는 실행 시간에 스칼라 코드로 전환한다.
+*/
+#if defined(SORT_LESS_DEFAULT) && defined(__GNUC__) \
+    && (defined(__x86_64__) || defined(__i386__)) && !defined(SORTING_NETWORK_NO_SIMD)
+
+#define SORTING_NETWORK_AVX2
+
+#include <immintrin.h>
+
+#endif
+
+/* | 라이브러리 함수... | */
+
+/* 두 원소를 비교하여, 더 작은 원소가 앞에 오도록 조건 분기 없이 맞바꾼다. */
+#define SORTING_NETWORK_EXCHANGE(a, b)           \
+    do {                                         \
+        T _a = (a), _b = (b);                    \
+        int _less = SORT_LESS(_b, _a);           \
+        (a) = _less ? _b : _a;                   \
+        (b) = _less ? _a : _b;                   \
+    } while (0)
+
+/* 
+    주어진 배열을 바이토닉 정렬 네트워크로 정렬한다.
+
+    각 단계의 첫 번째 비교는 뒤쪽 절반을 뒤집어서 비교하기 때문에, 모든 
+    비교기가 작은 원소를 앞쪽으로 보낸다. 따라서 배열의 크기가 2의 
+    거듭제곱이 아니더라도, 배열의 끝 너머에 무한대가 있다고 생각하고
+    범위를 벗어나는 비교기를 모두 생략하면 된다.
+*/
+static void sorting_network_bitonic(T *values, size_t n) {
+    size_t size = 1;
+
+    while (size < n) 
+        size *= 2;
+
+    for (size_t k = 2; k <= size; k *= 2) {
+        // 크기가 `k`인 블록의 앞쪽 절반과 뒤집은 뒤쪽 절반을 비교한다.
+        for (size_t s = 0; s < n; s += k)
+            for (size_t i = s, l = s + k - 1; i < l; i++, l--)
+                if (l < n) SORTING_NETWORK_EXCHANGE(values[i], values[l]);
+
+        // 바이토닉 수열을 차례대로 합친다.
+        for (size_t j = k / 4; j > 0; j /= 2)
+            for (size_t s = 0; s + j < n; s += 2 * j)
+                for (size_t i = s; i < s + j && i + j < n; i++)
+                    SORTING_NETWORK_EXCHANGE(values[i], values[i + j]);
+    }
+}
+
+#ifdef SORTING_NETWORK_AVX2
+
+/* 벡터 안에서 `lane ^ j`번째 원소와 비교하여, 작은 원소가 앞에 오도록 한다. */
+__attribute__((target("avx2"))) 
+static inline __m256i sorting_network_exchange_lanes(__m256i x, __m256i index, __m256i lower) {
+    __m256i y = _mm256_permutevar8x32_epi32(x, index);
+
+    return _mm256_blendv_epi8(_mm256_max_epi32(x, y), _mm256_min_epi32(x, y), lower);
+}
+
+/* AVX2 명령어를 이용하여, 최대 64개의 원소를 바이토닉 정렬 네트워크로 정렬한다. */
+__attribute__((target("avx2"))) 
+static void sorting_network_bitonic_avx2(T *values, size_t n) {
+    // `lane ^ 1`, `lane ^ 2`, `lane ^ 4`번째 원소를 가져오는 인덱스.
+    const __m256i xor_index[3] = {
+        _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6),
+        _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5),
+        _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3)
+    };
+
+    // `lane ^ 1`, `lane ^ 3`, `lane ^ 7`번째 원소를 가져오는 인덱스.
+    const __m256i flip_index[3] = {
+        _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6),
+        _mm256_setr_epi32(3, 2, 1, 0, 7, 6, 5, 4),
+        _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0)
+    };
+
+    // 작은 원소를 가져야 하는 위치. (`lane & j == 0`)
+    const __m256i lower[3] = {
+        _mm256_setr_epi32(-1, 0, -1, 0, -1, 0, -1, 0),
+        _mm256_setr_epi32(-1, -1, 0, 0, -1, -1, 0, 0),
+        _mm256_setr_epi32(-1, -1, -1, -1, 0, 0, 0, 0)
+    };
+
+    int buffer[SORTING_NETWORK_MAX_SIZE];
+
+    __m256i x[SORTING_NETWORK_MAX_SIZE / 8];
+
+    size_t vectors = 1;
+
+    while (8 * vectors < n) 
+        vectors *= 2;
+
+    // 빈 자리는 가장 큰 값으로 채운다.
+    for (size_t i = 0; i < 8 * vectors; i++)
+        buffer[i] = (i < n) ? values[i] : INT_MAX;
+
+    for (size_t v = 0; v < vectors; v++)
+        x[v] = _mm256_loadu_si256((const __m256i *) (buffer + 8 * v));
+
+    for (size_t k = 2; k <= 8 * vectors; k *= 2) {
+        int b = 0;
+
+        // 크기가 `k`인 블록의 앞쪽 절반과 뒤집은 뒤쪽 절반을 비교한다.
+        if (k <= 8) {
+            while ((2u << b) < k) b++;
+
+            for (size_t v = 0; v < vectors; v++)
+                x[v] = sorting_network_exchange_lanes(x[v], flip_index[b], lower[b]);
+        } else {
+            size_t mask = k / 8 - 1;
+
+            for (size_t v = 0; v < vectors; v++) {
+                size_t u = v ^ mask;
+
+                if (u <= v) continue;
+
+                // 뒤쪽 벡터의 원소 순서를 뒤집어서 비교한다.
+                __m256i y = _mm256_permutevar8x32_epi32(x[u], flip_index[2]);
+
+                __m256i lo = _mm256_min_epi32(x[v], y);
+                __m256i hi = _mm256_max_epi32(x[v], y);
+
+                x[v] = lo;
+                x[u] = _mm256_permutevar8x32_epi32(hi, flip_index[2]);
+            }
+        }
+
+        // 바이토닉 수열을 차례대로 합친다.
+        for (size_t j = k / 4; j > 0; j /= 2) {
+            if (j >= 8) {
+                size_t d = j / 8;
+
+                for (size_t v = 0; v < vectors; v++) {
+                    if (v & d) continue;
+
+                    __m256i lo = _mm256_min_epi32(x[v], x[v | d]);
+                    __m256i hi = _mm256_max_epi32(x[v], x[v | d]);
+
+                    x[v] = lo;
+                    x[v | d] = hi;
+                }
+            } else {
+                b = (j == 1) ? 0 : (j == 2) ? 1 : 2;
+
+                for (size_t v = 0; v < vectors; v++)
+                    x[v] = sorting_network_exchange_lanes(x[v], xor_index[b], lower[b]);
+            }
+        }
+    }
+
+    for (size_t v = 0; v < vectors; v++)
+        _mm256_storeu_si256((__m256i *) (buffer + 8 * v), x[v]);
+
+    for (size_t i = 0; i < n; i++)
+        values[i] = buffer[i];
+}
+
+#endif
+
+/* 주어진 배열을 정렬 네트워크로 정렬한다. */
+void sorting_network_sort(T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        정렬 네트워크는 입력 배열과 상관없이 항상 같은 순서로 두 원소를
+        비교하고 맞바꾸는 정렬 방법으로, 비교 결과에 따라 실행 흐름이
+        바뀌지 않기 때문에 분기 예측 실패가 일어나지 않는다. 또한, 서로
+        겹치지 않는 비교기들은 동시에 실행할 수 있어서 SIMD 명령어로 
+        여러 원소를 한꺼번에 처리하기도 좋다.
+
+        정렬 네트워크의 비교 횟수는 `O(n * (log n)^2)`이므로, 퀵 정렬이나
+        병합 정렬에서 크기가 작은 부분 배열을 정렬할 때 사용하면 좋다.
+    */
+
+    if (n > SORTING_NETWORK_MAX_SIZE) {
+        // 배열의 크기가 너무 크면, 삽입 정렬을 이용한다.
+        for (size_t i = 1; i < n; i++) {
+            T value = values[i];
+
+            size_t j = i;
+
+            for (; j > 0 && SORT_LESS(value, values[j - 1]); j--)
+                values[j] = values[j - 1];
+
+            values[j] = value;
+        }
+
+        return;
+    }
+
+#ifdef SORTING_NETWORK_AVX2
+    if (n >= 8 && __builtin_cpu_supports("avx2")) {
+        sorting_network_bitonic_avx2(values, n);
+
+        return;
+    }
+#endif
+
+    sorting_network_bitonic(values, n);
+}
+
+#endif // `SORTING_NETWORK_IMPLEMENTATION`
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#define STRING_SORT_IMPLEMENTATION
+#include "string-sort.h"
+
+/* `valgrind --tool=memcheck --leak-check=yes --show-reachable=yes --num-callers=20 ./bin/string-sort.out` */
+
+int main(void) {
+    char *values[] = { "banana", "apple", "cherry", "apricot", "band", "app", "blueberry", "bandana", "" };
+
+    size_t length = sizeof(values) / sizeof(*values);
+
+    string_sort_multikey(values, length);
+
+    for (int i = 0; i < length - 1; i++)
+        printf("\"%s\", ", values[i]);
+
+    printf("\"%s\"\n", values[length - 1]);
+
+    string_sort_msd(values, length);
+
+    for (int i = 0; i < length - 1; i++)
+        printf("\"%s\", ", values[i]);
+
+    printf("\"%s\"\n", values[length - 1]);
+
+    // 앞부분이 겹치는 문자열이 많아도, 재귀 호출의 깊이는 늘어나지 않는다.
+    const size_t nested_length = 6000;
+
+    char **nested_values = malloc(nested_length * sizeof *nested_values);
+
+    if (nested_values == NULL) return 1;
+
+    // `nested_values[i]`는 `i`개의 `'a'` 뒤에 `'b'`가 붙은 문자열이다.
+    for (size_t i = 0; i < nested_length; i++) {
+        nested_values[i] = malloc(i + 2);
+
+        if (nested_values[i] == NULL) return 1;
+
+        memset(nested_values[i], 'a', i);
+
+        nested_values[i][i] = 'b', nested_values[i][i + 1] = '\0';
+    }
+
+    string_sort_msd(nested_values, nested_length);
+
+    size_t i = 1;
+
+    while (i < nested_length && strcmp(nested_values[i - 1], nested_values[i]) <= 0) i++;
+
+    printf("nested prefixes: %s\n", (i == nested_length) ? "sorted" : "not sorted");
+
+    for (size_t i = 0; i < nested_length; i++)
+        free(nested_values[i]);
+
+    free(nested_values);
+
+    return 0;
+}
\ No newline at end of file
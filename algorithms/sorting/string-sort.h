@@ -0,0 +1,320 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef STRING_SORT_H
+#define STRING_SORT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* | 매크로 정의... | */
+
+/* 다중 키 퀵 정렬에서 삽입 정렬을 사용할 부분 배열의 최대 크기. */
+#define STRING_SORT_MULTIKEY_THRESHOLD  16
+
+/* MSD 기수 정렬에서 삽입 정렬을 사용할 버킷의 최대 크기. */
+#define STRING_SORT_MSD_THRESHOLD       32
+
+/* | 자료형 선언 및 정의... | */
+
+/* 다중 키 퀵 정렬에서 문자열과 함께 옮길 키를 나타내는 구조체. */
+typedef struct StringSortKey {
+    char *string;    // 문자열의 시작 주소.
+    uint64_t cache;  // 현재 깊이부터 시작하는 문자 8개.
+} StringSortKey;
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 문자열 배열을 다중 키 퀵 정렬 (multikey quicksort)한다. */
+void string_sort_multikey(char **strings, size_t n);
+
+/* 주어진 문자열 배열을 MSD 기수 정렬한다. */
+void string_sort_msd(char **strings, size_t n);
+
+#endif // `STRING_SORT_H`
+
+#ifdef STRING_SORT_IMPLEMENTATION
+
+/* | 라이브러리 함수... | */
+
+/* 
+    문자열의 `depth`번째 문자부터 최대 8개의 문자를 읽어서, 사전 순서와 
+    대소 관계가 같은 64비트 정수로 만든다. (문자열이 끝나면 0으로 채운다.)
+*/
+static inline uint64_t string_sort_load(const char *string, size_t depth) {
+    const unsigned char *s = (const unsigned char *) string + depth;
+
+    uint64_t result = 0;
+
+    for (int i = 0; i < 8; i++) {
+        result <<= 8;
+
+        if (*s != '\0') result |= *s++;
+    }
+
+    return result;
+}
+
+/* 
+    `depth`번째 문자까지 같은 두 키를 비교한다. 
+
+    캐시한 8개의 문자가 같고 문자열이 아직 끝나지 않았을 때만, 문자열을 
+    직접 비교한다.
+*/
+static inline int string_sort_compare(const StringSortKey *a, const StringSortKey *b, size_t depth) {
+    if (a->cache != b->cache) return (a->cache < b->cache) ? -1 : 1;
+
+    if ((a->cache & 0xFF) == 0) return 0;
+
+    return strcmp(a->string + depth + 8, b->string + depth + 8);
+}
+
+/* 주어진 키 배열을 삽입 정렬한다. */
+static void string_sort_multikey_insertion(StringSortKey *keys, size_t n, size_t depth) {
+    for (size_t i = 1; i < n; i++) {
+        StringSortKey key = keys[i];
+
+        size_t j = i;
+
+        for (; j > 0 && string_sort_compare(&key, &keys[j - 1], depth) < 0; j--)
+            keys[j] = keys[j - 1];
+
+        keys[j] = key;
+    }
+}
+
+/* 세 키의 캐시 중에서 중앙값을 반환한다. */
+static inline uint64_t string_sort_median3(uint64_t a, uint64_t b, uint64_t c) {
+    if (a < b) return (b < c) ? b : ((a < c) ? c : a);
+    else return (a < c) ? a : ((b < c) ? c : b);
+}
+
+/* (주어진 키 배열을 다중 키 퀵 정렬한다.) */
+static void string_sort_multikey_helper(StringSortKey *keys, size_t n, size_t depth) {
+    while (n > STRING_SORT_MULTIKEY_THRESHOLD) {
+        uint64_t pivot = string_sort_median3(keys[0].cache, keys[n / 2].cache, keys[n - 1].cache);
+
+        // 캐시를 기준으로 `[0, lt)`, `[lt, gt)`, `[gt, n)`의 세 부분으로 나눈다. (Dijkstra)
+        size_t lt = 0, i = 0, gt = n;
+
+        while (i < gt) {
+            if (keys[i].cache < pivot) {
+                StringSortKey key = keys[i];
+
+                keys[i++] = keys[lt], keys[lt++] = key;
+            } else if (keys[i].cache > pivot) {
+                StringSortKey key = keys[i];
+
+                keys[i] = keys[--gt], keys[gt] = key;
+            } else {
+                i++;
+            }
+        }
+
+        string_sort_multikey_helper(keys, lt, depth);
+        string_sort_multikey_helper(keys + gt, n - gt, depth);
+
+        // 문자열이 캐시 안에서 끝났다면, 가운데 부분의 문자열은 모두 같다.
+        if ((pivot & 0xFF) == 0) return;
+
+        // 가운데 부분은 다음 8개의 문자를 캐시한 다음, 그대로 이어서 정렬한다.
+        keys += lt, n = gt - lt, depth += 8;
+
+        for (size_t j = 0; j < n; j++)
+            keys[j].cache = string_sort_load(keys[j].string, depth);
+    }
+
+    string_sort_multikey_insertion(keys, n, depth);
+}
+
+/* 주어진 문자열 배열을 다중 키 퀵 정렬 (multikey quicksort)한다. */
+void string_sort_multikey(char **strings, size_t n) {
+    if (strings == NULL || n <= 1) return;
+
+    /*
+        `strcmp()`로 두 문자열을 비교하는 퀵 정렬은, 앞부분이 같은 문자열을
+        비교할 때마다 같은 문자들을 처음부터 다시 읽는다. 다중 키 퀵 정렬은
+        문자열 전체 대신 `depth`번째 문자만을 기준으로 배열을 세 부분으로 
+        나누고, 기준 항목과 문자가 같은 가운데 부분만 다음 문자로 넘어가서 
+        정렬하기 때문에 이미 비교한 앞부분을 다시 읽지 않는다. (3-way radix 
+        quicksort)
+
+        여기서는 문자를 하나씩 비교하는 대신 8개의 문자를 64비트 정수 
+        하나로 묶어서 문자열 포인터 옆에 캐시해 둔다. 분할 과정에서는 
+        연속된 키 배열만 읽으므로 문자열을 찾아 메모리를 여기저기 읽지 
+        않아도 되며, 한 번의 비교로 8개의 문자를 처리할 수 있다. 
+        
+        키 배열을 저장하기 위해 배열의 크기에 비례하는 임시 메모리 공간이
+        필요하다.
+    */
+
+    StringSortKey *keys = malloc(n * sizeof *keys);
+
+    if (keys == NULL) return;
+
+    for (size_t i = 0; i < n; i++) {
+        keys[i].string = strings[i];
+        keys[i].cache = string_sort_load(strings[i], 0);
+    }
+
+    string_sort_multikey_helper(keys, n, 0);
+
+    for (size_t i = 0; i < n; i++)
+        strings[i] = keys[i].string;
+
+    free(keys);
+}
+
+/* `depth`번째 문자까지 같은 문자열 배열을 삽입 정렬한다. */
+static void string_sort_msd_insertion(char **strings, size_t n, size_t depth) {
+    for (size_t i = 1; i < n; i++) {
+        char *string = strings[i];
+
+        size_t j = i;
+
+        for (; j > 0 && strcmp(string + depth, strings[j - 1] + depth) < 0; j--)
+            strings[j] = strings[j - 1];
+
+        strings[j] = string;
+    }
+}
+
+/* 
+    `depth`번째 문자부터 시작하는 모든 문자열의 공통 접두사의 길이를 구한다. 
+
+    문자열마다 연속된 문자들을 한꺼번에 읽으므로, 공통 접두사의 문자마다
+    배열 전체를 다시 읽는 것보다 캐시 효율이 좋다.
+*/
+static size_t string_sort_common_prefix(char **strings, size_t n, size_t depth) {
+    const char *first = strings[0] + depth;
+
+    size_t result = strlen(first);
+
+    for (size_t i = 1; i < n && result > 0; i++) {
+        const char *string = strings[i] + depth;
+
+        size_t j = 0;
+
+        while (j < result && string[j] == first[j]) j++;
+
+        result = j;
+    }
+
+    return result;
+}
+
+/* (주어진 문자열 배열을 MSD 기수 정렬한다.) */
+static void string_sort_msd_helper(char **strings, size_t n, size_t depth, char **aux, unsigned char *oracle) {
+    while (n > STRING_SORT_MSD_THRESHOLD) {
+        size_t counts[256] = { 0 };
+
+        // 각 문자열의 `depth`번째 문자를 한 번만 읽어서 저장해 둔다.
+        for (size_t i = 0; i < n; i++) {
+            oracle[i] = (unsigned char) strings[i][depth];
+
+            counts[oracle[i]]++;
+        }
+
+        // 모든 문자열의 문자가 같다면, 원소를 옮기지 않고 공통 접두사를 건너뛴다.
+        if (counts[oracle[0]] == n) {
+            if (oracle[0] == '\0') return;
+
+            depth += string_sort_common_prefix(strings, n, depth);
+
+            continue;
+        }
+
+        size_t offset = 0;
+
+        for (int c = 0; c < 256; c++) {
+            size_t count = counts[c];
+
+            counts[c] = offset;
+            offset += count;
+        }
+
+        for (size_t i = 0; i < n; i++)
+            aux[counts[oracle[i]]++] = strings[i];
+
+        memcpy(strings, aux, n * sizeof *strings);
+
+        int largest = 1;
+
+        for (int c = 2; c < 256; c++)
+            if (counts[c] - counts[c - 1] > counts[largest] - counts[largest - 1])
+                largest = c;
+
+        /*
+            문자열이 끝난 버킷 (`'\0'`)을 제외한 나머지 버킷을 정렬한다. 
+            
+            가장 큰 버킷을 제외한 버킷은 원래 배열의 절반보다 작으므로, 
+            그러한 버킷만 재귀적으로 정렬하고 가장 큰 버킷은 반복문에서 
+            계속 정렬하면, 재귀 호출의 깊이가 `O(log n)`을 넘지 않는다.
+        */
+        for (int c = 1; c < 256; c++) {
+            size_t low = counts[c - 1], high = counts[c];
+
+            if (c != largest && high - low > 1)
+                string_sort_msd_helper(strings + low, high - low, depth + 1, aux, oracle);
+        }
+
+        strings += counts[largest - 1];
+        n = counts[largest] - counts[largest - 1];
+
+        depth++;
+    }
+
+    if (n > 1) string_sort_msd_insertion(strings, n, depth);
+}
+
+/* 주어진 문자열 배열을 MSD 기수 정렬한다. */
+void string_sort_msd(char **strings, size_t n) {
+    if (strings == NULL || n <= 1) return;
+
+    /*
+        MSD 기수 정렬은 문자열의 첫 번째 문자부터 차례대로, 같은 문자를 
+        가진 문자열끼리 버킷으로 나누는 과정을 반복하는 정렬 알고리즘이다.
+        각 문자를 정확히 한 번씩만 읽기 때문에, 앞부분이 같은 문자열이 
+        많은 배열에서도 `strcmp()`를 반복하지 않는다.
+
+        버킷을 나눌 때마다 문자열의 `depth`번째 문자를 두 번 (개수를 셀 때와
+        원소를 옮길 때) 읽어야 하는데, 문자열은 메모리 여기저기에 흩어져 
+        있으므로 처음 읽을 때 문자를 연속된 배열에 저장해 두고 다시 사용한다.
+        또한, 크기가 작은 버킷은 256개의 버킷을 만드는 비용이 더 크므로 
+        삽입 정렬로 정렬한다.
+    */
+
+    char **aux = malloc(n * sizeof *aux);
+
+    unsigned char *oracle = malloc(n * sizeof *oracle);
+
+    if (aux != NULL && oracle != NULL)
+        string_sort_msd_helper(strings, n, 0, aux, oracle);
+
+    free(aux);
+    free(oracle);
+}
+
+#endif // `STRING_SORT_IMPLEMENTATION`
\ No newline at end of file
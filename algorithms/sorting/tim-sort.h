@@ -0,0 +1,600 @@
+/*
+    Copyright (c) 2022 Jaedeok Kim (https://github.com/jdeokkim)
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to deal
+    in the Software without restriction, including without limitation the rights
+    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+    copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all
+    copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+    SOFTWARE.
+*/
+
+#ifndef TIM_SORT_H
+#define TIM_SORT_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* | 매크로 정의... | */
+
+/* 합치기를 시작할 배열의 최소 크기. (이보다 작으면 이진 삽입 정렬만 사용한다.) */
+#define TIM_SORT_MIN_MERGE    64
+
+/* 질주 모드 (galloping mode)로 전환하기 위해 한쪽 런에서 연속으로 가져와야 하는 원소의 개수. */
+#define TIM_SORT_MIN_GALLOP   7
+
+/* 런 스택의 최대 크기. */
+#define TIM_SORT_MAX_RUNS     96
+
+#ifndef SORT_LESS
+
+/* 첫 번째 원소가 두 번째 원소보다 작은지 확인한다. */
+#define SORT_LESS(a, b)  ((a) < (b))
+
+/* `SORT_LESS`가 기본 비교 연산자를 사용하는지 여부. */
+#define SORT_LESS_DEFAULT
+
+#endif
+
+/* | 자료형 선언 및 정의... | */
+
+/* 정렬할 원소의 자료형. */
+typedef int T;
+
+/* | 라이브러리 함수... | */
+
+/* 주어진 배열을 팀 정렬한다. */
+void tim_sort(T *values, size_t n);
+
+#endif // `TIM_SORT_H`
+
+#if defined(TIM_SORT_IMPLEMENTATION) && !defined(TIM_SORT_IMPLEMENTED)
+
+/* 다른 헤더 파일에서 이 헤더 파일을 다시 포함하더라도, 구현은 한 번만 포함한다. */
+#define TIM_SORT_IMPLEMENTED
+
+/* | 자료형 선언 및 정의... | */
+
+/* 팀 정렬의 상태를 나타내는 구조체. */
+typedef struct TimSortState {
+    T *values;                               // 정렬할 배열.
+    T *aux;                                  // 런을 합칠 때 사용할 임시 메모리 공간.
+    ptrdiff_t min_gallop;                    // 질주 모드로 전환하기 위한 기준값.
+    ptrdiff_t run_base[TIM_SORT_MAX_RUNS];   // 각 런의 시작 위치.
+    ptrdiff_t run_len[TIM_SORT_MAX_RUNS];    // 각 런의 길이.
+    int run_count;                           // 런 스택에 저장된 런의 개수.
+} TimSortState;
+
+/* | 라이브러리 함수... | */
+
+/* 
+    배열의 크기가 `n`일 때, 런의 최소 길이를 계산한다.
+
+    `n`을 런의 최소 길이로 나눈 값이 2의 거듭제곱과 같거나 조금 작아지도록
+    `[TIM_SORT_MIN_MERGE / 2, TIM_SORT_MIN_MERGE]` 범위에서 값을 고르면, 
+    나중에 런을 합칠 때 크기가 비슷한 런끼리 합쳐지게 된다.
+*/
+static ptrdiff_t tim_sort_min_run(ptrdiff_t n) {
+    ptrdiff_t r = 0;
+
+    while (n >= TIM_SORT_MIN_MERGE) {
+        r |= n & 1;
+        n >>= 1;
+    }
+
+    return n + r;
+}
+
+/* 
+    `low`번째 원소부터 시작하는 런의 길이를 반환한다. 
+    
+    런이 내림차순이라면, 런을 뒤집어 오름차순으로 만든다. 같은 값을 가진
+    원소의 순서가 바뀌지 않도록, 내림차순 런은 엄격하게 감소해야 한다.
+*/
+static ptrdiff_t tim_sort_count_run(T *values, ptrdiff_t low, ptrdiff_t high) {
+    ptrdiff_t run_high = low + 1;
+
+    if (run_high == high) return 1;
+
+    if (SORT_LESS(values[run_high++], values[low])) {
+        while (run_high < high && SORT_LESS(values[run_high], values[run_high - 1]))
+            run_high++;
+
+        // 내림차순 런을 뒤집는다.
+        for (ptrdiff_t i = low, j = run_high - 1; i < j; i++, j--) {
+            T value = values[i];
+
+            values[i] = values[j];
+            values[j] = value;
+        }
+    } else {
+        while (run_high < high && !SORT_LESS(values[run_high], values[run_high - 1]))
+            run_high++;
+    }
+
+    return run_high - low;
+}
+
+/* 이미 정렬된 부분 배열 `[low, start)`에 `[start, high)`의 원소들을 이진 삽입 정렬로 추가한다. */
+static void tim_sort_binary_insertion(T *values, ptrdiff_t low, ptrdiff_t high, ptrdiff_t start) {
+    for (; start < high; start++) {
+        T pivot = values[start];
+
+        ptrdiff_t left = low, right = start;
+
+        // 같은 값을 가진 원소들보다 뒤에 오도록, 삽입할 위치를 찾는다.
+        while (left < right) {
+            ptrdiff_t mid = left + (right - left) / 2;
+
+            if (SORT_LESS(pivot, values[mid])) right = mid;
+            else left = mid + 1;
+        }
+
+        memmove(values + left + 1, values + left, (start - left) * sizeof *values);
+
+        values[left] = pivot;
+    }
+}
+
+/* 
+    정렬된 배열 `a`에서 `key`가 들어갈 가장 왼쪽 위치를 찾는다. 
+
+    `hint`번째 위치에서 시작하여 1, 3, 7, 15, ... 칸씩 건너뛰며 범위를
+    좁힌 다음 (galloping), 그 범위 안에서 이진 탐색을 한다.
+*/
+static ptrdiff_t tim_sort_gallop_left(T key, const T *a, ptrdiff_t len, ptrdiff_t hint) {
+    ptrdiff_t last_ofs = 0, ofs = 1;
+
+    if (SORT_LESS(a[hint], key)) {
+        // `a[hint + last_ofs] < key <= a[hint + ofs]`가 될 때까지 오른쪽으로 건너뛴다.
+        ptrdiff_t max_ofs = len - hint;
+
+        while (ofs < max_ofs && SORT_LESS(a[hint + ofs], key)) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+
+        if (ofs > max_ofs) ofs = max_ofs;
+
+        last_ofs += hint;
+        ofs += hint;
+    } else {
+        // `a[hint - ofs] < key <= a[hint - last_ofs]`가 될 때까지 왼쪽으로 건너뛴다.
+        ptrdiff_t max_ofs = hint + 1;
+
+        while (ofs < max_ofs && !SORT_LESS(a[hint - ofs], key)) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+
+        if (ofs > max_ofs) ofs = max_ofs;
+
+        ptrdiff_t temp = last_ofs;
+
+        last_ofs = hint - ofs;
+        ofs = hint - temp;
+    }
+
+    // `a[last_ofs] < key <= a[ofs]`이므로, 그 사이에서 이진 탐색을 한다.
+    last_ofs++;
+
+    while (last_ofs < ofs) {
+        ptrdiff_t m = last_ofs + (ofs - last_ofs) / 2;
+
+        if (SORT_LESS(a[m], key)) last_ofs = m + 1;
+        else ofs = m;
+    }
+
+    return ofs;
+}
+
+/* 정렬된 배열 `a`에서 `key`가 들어갈 가장 오른쪽 위치를 찾는다. */
+static ptrdiff_t tim_sort_gallop_right(T key, const T *a, ptrdiff_t len, ptrdiff_t hint) {
+    ptrdiff_t last_ofs = 0, ofs = 1;
+
+    if (SORT_LESS(key, a[hint])) {
+        // `a[hint - ofs] <= key < a[hint - last_ofs]`가 될 때까지 왼쪽으로 건너뛴다.
+        ptrdiff_t max_ofs = hint + 1;
+
+        while (ofs < max_ofs && SORT_LESS(key, a[hint - ofs])) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+
+        if (ofs > max_ofs) ofs = max_ofs;
+
+        ptrdiff_t temp = last_ofs;
+
+        last_ofs = hint - ofs;
+        ofs = hint - temp;
+    } else {
+        // `a[hint + last_ofs] <= key < a[hint + ofs]`가 될 때까지 오른쪽으로 건너뛴다.
+        ptrdiff_t max_ofs = len - hint;
+
+        while (ofs < max_ofs && !SORT_LESS(key, a[hint + ofs])) {
+            last_ofs = ofs;
+            ofs = (ofs << 1) + 1;
+        }
+
+        if (ofs > max_ofs) ofs = max_ofs;
+
+        last_ofs += hint;
+        ofs += hint;
+    }
+
+    // `a[last_ofs] <= key < a[ofs]`이므로, 그 사이에서 이진 탐색을 한다.
+    last_ofs++;
+
+    while (last_ofs < ofs) {
+        ptrdiff_t m = last_ofs + (ofs - last_ofs) / 2;
+
+        if (SORT_LESS(key, a[m])) ofs = m;
+        else last_ofs = m + 1;
+    }
+
+    return ofs;
+}
+
+/* 
+    인접한 두 런을 앞쪽에서부터 합친다. (`len1 <= len2`)
+
+    앞쪽 런을 임시 메모리 공간으로 옮긴 다음, 두 런의 원소를 하나씩 
+    비교하며 합친다. 한쪽 런에서 연속으로 원소를 가져오는 일이 자주
+    일어나면, 질주 모드로 전환하여 한꺼번에 여러 원소를 옮긴다.
+*/
+static void tim_sort_merge_lo(TimSortState *ts, ptrdiff_t base1, ptrdiff_t len1, ptrdiff_t base2, ptrdiff_t len2) {
+    T *a = ts->values, *tmp = ts->aux;
+
+    memcpy(tmp, a + base1, len1 * sizeof *tmp);
+
+    ptrdiff_t cursor1 = 0, cursor2 = base2, dest = base1;
+
+    a[dest++] = a[cursor2++];
+
+    if (--len2 == 0) {
+        memcpy(a + dest, tmp + cursor1, len1 * sizeof *a);
+
+        return;
+    }
+
+    if (len1 == 1) {
+        memmove(a + dest, a + cursor2, len2 * sizeof *a);
+
+        a[dest + len2] = tmp[cursor1];
+
+        return;
+    }
+
+    ptrdiff_t min_gallop = ts->min_gallop;
+
+    for (;;) {
+        ptrdiff_t count1 = 0, count2 = 0;
+
+        // 한쪽 런이 계속 이길 때까지, 원소를 하나씩 비교하며 합친다.
+        do {
+            if (SORT_LESS(a[cursor2], tmp[cursor1])) {
+                a[dest++] = a[cursor2++];
+
+                count2++, count1 = 0;
+
+                if (--len2 == 0) goto done;
+            } else {
+                a[dest++] = tmp[cursor1++];
+
+                count1++, count2 = 0;
+
+                if (--len1 == 1) goto done;
+            }
+        } while ((count1 | count2) < min_gallop);
+
+        // 질주 모드에서는 한쪽 런에서 가져올 원소의 개수를 한꺼번에 찾는다.
+        do {
+            count1 = tim_sort_gallop_right(a[cursor2], tmp + cursor1, len1, 0);
+
+            if (count1 != 0) {
+                memcpy(a + dest, tmp + cursor1, count1 * sizeof *a);
+
+                dest += count1, cursor1 += count1, len1 -= count1;
+
+                if (len1 <= 1) goto done;
+            }
+
+            a[dest++] = a[cursor2++];
+
+            if (--len2 == 0) goto done;
+
+            count2 = tim_sort_gallop_left(tmp[cursor1], a + cursor2, len2, 0);
+
+            if (count2 != 0) {
+                memmove(a + dest, a + cursor2, count2 * sizeof *a);
+
+                dest += count2, cursor2 += count2, len2 -= count2;
+
+                if (len2 == 0) goto done;
+            }
+
+            a[dest++] = tmp[cursor1++];
+
+            if (--len1 == 1) goto done;
+
+            min_gallop--;
+        } while (count1 >= TIM_SORT_MIN_GALLOP || count2 >= TIM_SORT_MIN_GALLOP);
+
+        // 질주 모드에서 벗어나면, 다시 질주 모드로 전환하기 어렵게 만든다.
+        if (min_gallop < 0) min_gallop = 0;
+
+        min_gallop += 2;
+    }
+
+done:
+    ts->min_gallop = (min_gallop < 1) ? 1 : min_gallop;
+
+    if (len1 == 1) {
+        memmove(a + dest, a + cursor2, len2 * sizeof *a);
+
+        a[dest + len2] = tmp[cursor1];
+    } else if (len1 > 0) {
+        memcpy(a + dest, tmp + cursor1, len1 * sizeof *a);
+    }
+}
+
+/* 
+    인접한 두 런을 뒤쪽에서부터 합친다. (`len1 > len2`)
+
+    뒤쪽 런을 임시 메모리 공간으로 옮긴 다음, 두 런의 가장 큰 원소부터
+    비교하며 배열의 끝에서부터 채워 나간다.
+*/
+static void tim_sort_merge_hi(TimSortState *ts, ptrdiff_t base1, ptrdiff_t len1, ptrdiff_t base2, ptrdiff_t len2) {
+    T *a = ts->values, *tmp = ts->aux;
+
+    memcpy(tmp, a + base2, len2 * sizeof *tmp);
+
+    ptrdiff_t cursor1 = base1 + len1 - 1, cursor2 = len2 - 1, dest = base2 + len2 - 1;
+
+    a[dest--] = a[cursor1--];
+
+    if (--len1 == 0) {
+        memcpy(a + dest - (len2 - 1), tmp, len2 * sizeof *a);
+
+        return;
+    }
+
+    if (len2 == 1) {
+        dest -= len1, cursor1 -= len1;
+
+        memmove(a + dest + 1, a + cursor1 + 1, len1 * sizeof *a);
+
+        a[dest] = tmp[cursor2];
+
+        return;
+    }
+
+    ptrdiff_t min_gallop = ts->min_gallop;
+
+    for (;;) {
+        ptrdiff_t count1 = 0, count2 = 0;
+
+        // 한쪽 런이 계속 이길 때까지, 원소를 하나씩 비교하며 합친다.
+        do {
+            if (SORT_LESS(tmp[cursor2], a[cursor1])) {
+                a[dest--] = a[cursor1--];
+
+                count1++, count2 = 0;
+
+                if (--len1 == 0) goto done;
+            } else {
+                a[dest--] = tmp[cursor2--];
+
+                count2++, count1 = 0;
+
+                if (--len2 == 1) goto done;
+            }
+        } while ((count1 | count2) < min_gallop);
+
+        // 질주 모드에서는 한쪽 런에서 가져올 원소의 개수를 한꺼번에 찾는다.
+        do {
+            count1 = len1 - tim_sort_gallop_right(tmp[cursor2], a + base1, len1, len1 - 1);
+
+            if (count1 != 0) {
+                dest -= count1, cursor1 -= count1, len1 -= count1;
+
+                memmove(a + dest + 1, a + cursor1 + 1, count1 * sizeof *a);
+
+                if (len1 == 0) goto done;
+            }
+
+            a[dest--] = tmp[cursor2--];
+
+            if (--len2 == 1) goto done;
+
+            count2 = len2 - tim_sort_gallop_left(a[cursor1], tmp, len2, len2 - 1);
+
+            if (count2 != 0) {
+                dest -= count2, cursor2 -= count2, len2 -= count2;
+
+                memcpy(a + dest + 1, tmp + cursor2 + 1, count2 * sizeof *a);
+
+                if (len2 <= 1) goto done;
+            }
+
+            a[dest--] = a[cursor1--];
+
+            if (--len1 == 0) goto done;
+
+            min_gallop--;
+        } while (count1 >= TIM_SORT_MIN_GALLOP || count2 >= TIM_SORT_MIN_GALLOP);
+
+        // 질주 모드에서 벗어나면, 다시 질주 모드로 전환하기 어렵게 만든다.
+        if (min_gallop < 0) min_gallop = 0;
+
+        min_gallop += 2;
+    }
+
+done:
+    ts->min_gallop = (min_gallop < 1) ? 1 : min_gallop;
+
+    if (len2 == 1) {
+        dest -= len1, cursor1 -= len1;
+
+        memmove(a + dest + 1, a + cursor1 + 1, len1 * sizeof *a);
+
+        a[dest] = tmp[cursor2];
+    } else if (len2 > 0) {
+        memcpy(a + dest - (len2 - 1), tmp, len2 * sizeof *a);
+    }
+}
+
+/* 런 스택의 `i`번째 런과 `i + 1`번째 런을 합친다. */
+static void tim_sort_merge_at(TimSortState *ts, int i) {
+    ptrdiff_t base1 = ts->run_base[i], len1 = ts->run_len[i];
+    ptrdiff_t base2 = ts->run_base[i + 1], len2 = ts->run_len[i + 1];
+
+    ts->run_len[i] = len1 + len2;
+
+    if (i == ts->run_count - 3) {
+        ts->run_base[i + 1] = ts->run_base[i + 2];
+        ts->run_len[i + 1] = ts->run_len[i + 2];
+    }
+
+    ts->run_count--;
+
+    T *a = ts->values;
+
+    // 앞쪽 런에서 뒤쪽 런의 첫 번째 원소보다 작거나 같은 원소들은 이미 제자리에 있다.
+    ptrdiff_t k = tim_sort_gallop_right(a[base2], a + base1, len1, 0);
+
+    base1 += k, len1 -= k;
+
+    if (len1 == 0) return;
+
+    // 뒤쪽 런에서 앞쪽 런의 마지막 원소보다 크거나 같은 원소들도 이미 제자리에 있다.
+    len2 = tim_sort_gallop_left(a[base1 + len1 - 1], a + base2, len2, len2 - 1);
+
+    if (len2 == 0) return;
+
+    if (len1 <= len2) tim_sort_merge_lo(ts, base1, len1, base2, len2);
+    else tim_sort_merge_hi(ts, base1, len1, base2, len2);
+}
+
+/* 
+    런 스택의 불변 조건이 만족될 때까지 런을 합친다.
+
+    1. `run_len[i - 2] > run_len[i - 1] + run_len[i]`
+    2. `run_len[i - 1] > run_len[i]`
+
+    이 조건이 만족되면 런의 길이가 피보나치 수열보다 빠르게 증가하므로,
+    런 스택의 크기는 `O(log n)`을 넘지 않는다.
+*/
+static void tim_sort_merge_collapse(TimSortState *ts) {
+    while (ts->run_count > 1) {
+        int i = ts->run_count - 2;
+
+        ptrdiff_t *len = ts->run_len;
+
+        if ((i > 0 && len[i - 1] <= len[i] + len[i + 1]) 
+            || (i > 1 && len[i - 2] <= len[i] + len[i - 1])) {
+            if (len[i - 1] < len[i + 1]) i--;
+        } else if (len[i] > len[i + 1]) {
+            break;
+        }
+
+        tim_sort_merge_at(ts, i);
+    }
+}
+
+/* 런 스택에 남은 모든 런을 하나로 합친다. */
+static void tim_sort_merge_force_collapse(TimSortState *ts) {
+    while (ts->run_count > 1) {
+        int i = ts->run_count - 2;
+
+        if (i > 0 && ts->run_len[i - 1] < ts->run_len[i + 1]) i--;
+
+        tim_sort_merge_at(ts, i);
+    }
+}
+
+/* 주어진 배열을 팀 정렬한다. */
+void tim_sort(T *values, size_t n) {
+    if (values == NULL || n <= 1) return;
+
+    /*
+        팀 정렬은 병합 정렬과 삽입 정렬을 결합한 안정 정렬 알고리즘으로,
+        배열에 이미 존재하는 오름차순 또는 내림차순 부분 배열 (run)을
+        찾아서 그대로 활용한다. 따라서 거의 정렬된 배열은 `O(n)`에 가까운
+        시간에 정렬할 수 있으며, 최악의 경우에도 `O(n * log n)`의 시간
+        복잡도를 보장한다.
+
+        1. 배열의 앞에서부터 런을 찾고, 런이 너무 짧으면 이진 삽입 정렬로 
+           최소 길이까지 늘린다.
+        2. 찾은 런을 스택에 넣고, 스택의 불변 조건이 만족될 때까지 인접한
+           런끼리 합친다. 
+        3. 런을 합칠 때 한쪽 런에서 연속으로 원소를 가져오는 일이 자주
+           일어나면, 질주 모드로 전환하여 가져올 원소의 개수를 한꺼번에
+           찾는다. 뒤에 덧붙여진 원소가 조금 있는 배열처럼, 두 런이 거의
+           겹치지 않는 경우에는 비교 횟수가 `O(log n)`으로 줄어든다.
+    */
+
+    ptrdiff_t low = 0, remaining = (ptrdiff_t) n;
+
+    // 배열의 크기가 작으면, 이진 삽입 정렬만 사용한다.
+    if (remaining < TIM_SORT_MIN_MERGE) {
+        ptrdiff_t run_len = tim_sort_count_run(values, 0, remaining);
+
+        tim_sort_binary_insertion(values, 0, remaining, run_len);
+
+        return;
+    }
+
+    TimSortState ts = { .values = values, .min_gallop = TIM_SORT_MIN_GALLOP };
+
+    // 런을 합칠 때 필요한 임시 메모리 공간을 할당한다. (두 런 중에 짧은 쪽만 옮긴다.)
+    ts.aux = malloc((n / 2 + 1) * sizeof *ts.aux);
+
+    if (ts.aux == NULL) return;
+
+    ptrdiff_t min_run = tim_sort_min_run(remaining);
+
+    do {
+        // 다음 런을 찾는다.
+        ptrdiff_t run_len = tim_sort_count_run(values, low, low + remaining);
+
+        // 런이 너무 짧으면, 이진 삽입 정렬로 최소 길이까지 늘린다.
+        if (run_len < min_run) {
+            ptrdiff_t force = (remaining <= min_run) ? remaining : min_run;
+
+            tim_sort_binary_insertion(values, low, low + force, low + run_len);
+
+            run_len = force;
+        }
+
+        // 런을 스택에 넣고, 스택의 불변 조건을 확인한다.
+        ts.run_base[ts.run_count] = low;
+        ts.run_len[ts.run_count] = run_len;
+        ts.run_count++;
+
+        tim_sort_merge_collapse(&ts);
+
+        low += run_len;
+        remaining -= run_len;
+    } while (remaining != 0);
+
+    tim_sort_merge_force_collapse(&ts);
+
+    // 임시 메모리 공간을 해제한다.
+    free(ts.aux);
+}
+
+#endif // `TIM_SORT_IMPLEMENTATION`
\ No newline at end of file